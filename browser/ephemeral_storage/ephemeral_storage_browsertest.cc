@@ -6,6 +6,8 @@
 #include <string>
 
 #include "base/path_service.h"
+#include "base/timer/timer.h"
+#include "brave/browser/ephemeral_storage/ephemeral_storage_tab_helper.h"
 #include "brave/common/brave_paths.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
@@ -154,6 +156,13 @@ class EphemeralStorageBrowserTest : public InProcessBrowserTest {
     return add_tab.Wait();
   }
 
+  base::OneShotTimer* GetLocalStorageReleaseTimer(WebContents* web_contents) {
+    auto* tab_helper =
+        ephemeral_storage::EphemeralStorageTabHelper::FromWebContents(
+            web_contents);
+    return &tab_helper->local_storage_release_timer_;
+  }
+
  protected:
   net::test_server::EmbeddedTestServer https_server_;
   base::test::ScopedFeatureList scoped_feature_list_;
@@ -245,8 +254,12 @@ IN_PROC_BROWSER_TEST_F(EphemeralStorageBrowserTest,
   EXPECT_EQ("a.com value", values_before.iframe_1.session_storage);
   EXPECT_EQ("a.com value", values_before.iframe_2.session_storage);
 
-  // Navigate away and then navigate back to the original site.
+  // Navigate away, let the local storage release delay expire and then
+  // navigate back to the original site.
   ui_test_utils::NavigateToURL(browser(), b_site_ephemeral_storage_url_);
+  base::OneShotTimer* timer = GetLocalStorageReleaseTimer(web_contents);
+  ASSERT_TRUE(timer->IsRunning());
+  timer->FireNow();
   ui_test_utils::NavigateToURL(browser(), a_site_ephemeral_storage_url_);
 
   ValuesFromFrames values_after = GetValuesFromFrames(web_contents);
@@ -259,6 +272,62 @@ IN_PROC_BROWSER_TEST_F(EphemeralStorageBrowserTest,
   EXPECT_EQ(nullptr, values_after.iframe_2.session_storage);
 }
 
+IN_PROC_BROWSER_TEST_F(EphemeralStorageBrowserTest,
+                       NavigatingBackWithinDelayKeepsEphemeralLocalStorage) {
+  AllowAllCookies();
+
+  ui_test_utils::NavigateToURL(browser(), a_site_ephemeral_storage_url_);
+  auto* web_contents = browser()->tab_strip_model()->GetActiveWebContents();
+
+  SetValuesInFrames(web_contents, "a.com value", "from=a.com");
+
+  // Navigate away and come back before the local storage release delay
+  // expires.
+  ui_test_utils::NavigateToURL(browser(), b_site_ephemeral_storage_url_);
+  base::OneShotTimer* timer = GetLocalStorageReleaseTimer(web_contents);
+  EXPECT_TRUE(timer->IsRunning());
+  ui_test_utils::NavigateToURL(browser(), a_site_ephemeral_storage_url_);
+  EXPECT_FALSE(timer->IsRunning());
+
+  // Local storage is kept, session storage is always dropped.
+  ValuesFromFrames values_after = GetValuesFromFrames(web_contents);
+  EXPECT_EQ("a.com value", values_after.main_frame.local_storage);
+  EXPECT_EQ("a.com value", values_after.iframe_1.local_storage);
+  EXPECT_EQ("a.com value", values_after.iframe_2.local_storage);
+
+  EXPECT_EQ("a.com value", values_after.main_frame.session_storage);
+  EXPECT_EQ(nullptr, values_after.iframe_1.session_storage);
+  EXPECT_EQ(nullptr, values_after.iframe_2.session_storage);
+}
+
+IN_PROC_BROWSER_TEST_F(EphemeralStorageBrowserTest,
+                       NavigatingAgainDoesNotPostponeLocalStorageRelease) {
+  AllowAllCookies();
+
+  ui_test_utils::NavigateToURL(browser(), a_site_ephemeral_storage_url_);
+  auto* web_contents = browser()->tab_strip_model()->GetActiveWebContents();
+
+  SetValuesInFrames(web_contents, "a.com value", "from=a.com");
+
+  ui_test_utils::NavigateToURL(browser(), b_site_ephemeral_storage_url_);
+  base::OneShotTimer* timer = GetLocalStorageReleaseTimer(web_contents);
+  ASSERT_TRUE(timer->IsRunning());
+  const base::TimeTicks desired_run_time = timer->desired_run_time();
+
+  // Leaving for another domain keeps the original release time.
+  ui_test_utils::NavigateToURL(browser(), c_site_ephemeral_storage_url_);
+  ASSERT_TRUE(timer->IsRunning());
+  EXPECT_EQ(desired_run_time, timer->desired_run_time());
+
+  timer->FireNow();
+  ui_test_utils::NavigateToURL(browser(), a_site_ephemeral_storage_url_);
+
+  ValuesFromFrames values_after = GetValuesFromFrames(web_contents);
+  EXPECT_EQ("a.com value", values_after.main_frame.local_storage);
+  EXPECT_EQ(nullptr, values_after.iframe_1.local_storage);
+  EXPECT_EQ(nullptr, values_after.iframe_2.local_storage);
+}
+
 IN_PROC_BROWSER_TEST_F(EphemeralStorageBrowserTest,
                        ClosingTabClearsEphemeralStorage) {
   AllowAllCookies();
@@ -8,11 +8,14 @@
 #include <map>
 #include <set>
 
+#include "base/bind.h"
 #include "base/feature_list.h"
 #include "base/hash/md5.h"
 #include "base/no_destructor.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/navigation_handle.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
 #include "content/public/browser/session_storage_namespace.h"
 #include "content/public/browser/storage_partition.h"
 #include "content/public/browser/web_contents.h"
@@ -21,6 +24,7 @@
 
 using content::BrowserContext;
 using content::NavigationHandle;
+using content::RenderFrameHost;
 using content::SessionStorageNamespace;
 using content::WebContents;
 
@@ -28,6 +32,9 @@ namespace ephemeral_storage {
 
 namespace {
 
+constexpr base::TimeDelta kLocalStorageReleaseDelay =
+    base::TimeDelta::FromSeconds(5);
+
 std::string URLToStorageDomain(const GURL& url) {
   std::string domain = net::registry_controlled_domains::GetDomainAndRegistry(
       url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
@@ -55,18 +62,32 @@ std::string StringToSessionStorageId(const std::string& string,
 }  // namespace
 
 EphemeralStorageTabHelper::EphemeralStorageTabHelper(WebContents* web_contents)
-    : WebContentsObserver(web_contents) {
+    : WebContentsObserver(web_contents), receivers_(web_contents, this) {
   DCHECK(base::FeatureList::IsEnabled(blink::features::kBraveEphemeralStorage));
-
-  // The URL might not be empty if this is a restored WebContents, for instance.
-  // In that case we want to make sure it has valid ephemeral storage.
-  const GURL& url = web_contents->GetLastCommittedURL();
-  if (!url.is_empty())
-    CreateEphemeralStorageAreasForDomainAndURL(URLToStorageDomain(url), url);
 }
 
 EphemeralStorageTabHelper::~EphemeralStorageTabHelper() {}
 
+void EphemeralStorageTabHelper::GetNamespaceIds(
+    GetNamespaceIdsCallback callback) {
+  RenderFrameHost* render_frame_host = receivers_.GetCurrentTargetFrame();
+  // Only third-party frames use ephemeral storage.
+  if (!render_frame_host->GetParent()) {
+    std::move(callback).Run(std::string(), std::string());
+    return;
+  }
+
+  std::string domain = URLToStorageDomain(
+      render_frame_host->GetMainFrame()->GetLastCommittedURL());
+  if (domain != storage_domain_ || !local_storage_namespace_ ||
+      !session_storage_namespace_) {
+    CreateEphemeralStorageAreasForDomain(
+        domain, render_frame_host->GetProcess()->GetStoragePartition());
+  }
+
+  std::move(callback).Run(local_storage_id_, session_storage_id_);
+}
+
 void EphemeralStorageTabHelper::ReadyToCommitNavigation(
     NavigationHandle* navigation_handle) {
   if (!navigation_handle->IsInMainFrame())
@@ -74,47 +95,64 @@ void EphemeralStorageTabHelper::ReadyToCommitNavigation(
   if (navigation_handle->IsSameDocument())
     return;
 
-  const GURL& new_url = navigation_handle->GetURL();
-  std::string new_domain = URLToStorageDomain(new_url);
-  std::string previous_domain =
-      URLToStorageDomain(web_contents()->GetLastCommittedURL());
-  if (new_domain == previous_domain)
+  if (storage_domain_.empty())
     return;
 
-  CreateEphemeralStorageAreasForDomainAndURL(new_domain, new_url);
+  if (URLToStorageDomain(navigation_handle->GetURL()) == storage_domain_) {
+    // Coming back before the release delay keeps the local storage.
+    local_storage_release_timer_.Stop();
+    return;
+  }
+
+  // Session storage is always per-tab and never per-TLD, so it must not be
+  // carried over to the new domain.
+  session_storage_namespace_.reset();
+
+  // Leaving for yet another domain must not postpone the release of the
+  // local storage of the domain the namespaces were created for.
+  if (local_storage_namespace_ && !local_storage_release_timer_.IsRunning()) {
+    local_storage_release_timer_.Start(
+        FROM_HERE, kLocalStorageReleaseDelay,
+        base::BindOnce(&EphemeralStorageTabHelper::ReleaseLocalStorageNamespace,
+                       base::Unretained(this)));
+  }
 }
 
-void EphemeralStorageTabHelper::CreateEphemeralStorageAreasForDomainAndURL(
-    std::string new_domain,
-    const GURL& new_url) {
-  auto* browser_context = web_contents()->GetBrowserContext();
-  auto site_instance =
-      content::SiteInstance::CreateForURL(browser_context, new_url);
-  auto* partition =
-      BrowserContext::GetStoragePartition(browser_context, site_instance.get());
+void EphemeralStorageTabHelper::CreateEphemeralStorageAreasForDomain(
+    const std::string& domain,
+    content::StoragePartition* partition) {
+  local_storage_release_timer_.Stop();
 
   // This will fetch a session storage namespace for this storage partition
   // and storage domain. If another tab helper is already using the same
   // namespace, this will just give us a new reference. When the last tab helper
   // drops the reference, the namespace should be deleted.
-  std::string local_partition_id =
-      StringToSessionStorageId(new_domain, "/ephemeral-local-storage");
-  local_storage_namespace_ =
-      content::CreateSessionStorageNamespace(partition, local_partition_id);
-
-  // Session storage is always per-tab and never per-TLD, so we always delete
-  // and recreate the session storage when switching domains.
-  //
+  if (domain != storage_domain_ || !local_storage_namespace_) {
+    local_storage_id_ =
+        StringToSessionStorageId(domain, "/ephemeral-local-storage");
+    local_storage_namespace_ =
+        content::CreateSessionStorageNamespace(partition, local_storage_id_);
+  }
+
   // We need to explicitly release the storage namespace before recreating a
   // new one in order to make sure that we remove the final reference and free
   // it.
   session_storage_namespace_.reset();
 
-  std::string session_partition_id = StringToSessionStorageId(
-      content::GetSessionStorageNamespaceId(web_contents()),
-      "/ephemeral-session-storage");
+  if (session_storage_id_.empty()) {
+    session_storage_id_ = StringToSessionStorageId(
+        content::GetSessionStorageNamespaceId(web_contents()),
+        "/ephemeral-session-storage");
+  }
   session_storage_namespace_ =
-      content::CreateSessionStorageNamespace(partition, session_partition_id);
+      content::CreateSessionStorageNamespace(partition, session_storage_id_);
+
+  storage_domain_ = domain;
+}
+
+void EphemeralStorageTabHelper::ReleaseLocalStorageNamespace() {
+  local_storage_namespace_.reset();
+  storage_domain_.clear();
 }
 
 WEB_CONTENTS_USER_DATA_KEY_IMPL(EphemeralStorageTabHelper)
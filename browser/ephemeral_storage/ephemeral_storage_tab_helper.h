@@ -9,13 +9,19 @@
 #include <string>
 #include <utility>
 
+#include "base/timer/timer.h"
+#include "brave/components/ephemeral_storage/ephemeral_storage.mojom.h"
 #include "content/public/browser/session_storage_namespace.h"
 #include "content/public/browser/web_contents_observer.h"
+#include "content/public/browser/web_contents_receiver_set.h"
 #include "content/public/browser/web_contents_user_data.h"
 
+class EphemeralStorageBrowserTest;
+
 namespace content {
 class WebContents;
 class BrowserContext;
+class StoragePartition;
 }  // namespace content
 
 namespace ephemeral_storage {
@@ -25,25 +31,45 @@ namespace ephemeral_storage {
 // iframes. This storage is partitioned based on the origin of the TLD
 // of the main frame. When no more tabs are open with a particular origin,
 // this storage is cleared.
+// The storage namespaces are only created once a third-party frame asks for
+// them, so navigations of pages which never use ephemeral storage don't touch
+// the storage backend.
 class EphemeralStorageTabHelper
     : public content::WebContentsObserver,
-      public content::WebContentsUserData<EphemeralStorageTabHelper> {
+      public content::WebContentsUserData<EphemeralStorageTabHelper>,
+      public mojom::EphemeralStorage {
  public:
   explicit EphemeralStorageTabHelper(content::WebContents* web_contents);
   ~EphemeralStorageTabHelper() override;
 
+  // mojom::EphemeralStorage:
+  void GetNamespaceIds(GetNamespaceIdsCallback callback) override;
+
  protected:
   void ReadyToCommitNavigation(
       content::NavigationHandle* navigation_handle) override;
 
  private:
-  void CreateEphemeralStorageAreasForDomainAndURL(std::string new_domain,
-                                                  const GURL& new_url);
+  void CreateEphemeralStorageAreasForDomain(
+      const std::string& domain,
+      content::StoragePartition* partition);
+  void ReleaseLocalStorageNamespace();
 
+  friend class ::EphemeralStorageBrowserTest;
   friend class content::WebContentsUserData<EphemeralStorageTabHelper>;
+  content::WebContentsFrameReceiverSet<mojom::EphemeralStorage> receivers_;
+
+  // The domain the namespaces below were created for.
+  std::string storage_domain_;
+  std::string local_storage_id_;
+  std::string session_storage_id_;
   scoped_refptr<content::SessionStorageNamespace> local_storage_namespace_;
   scoped_refptr<content::SessionStorageNamespace> session_storage_namespace_;
 
+  // Releases the local storage of the previous domain a while after the tab
+  // leaves it, so that coming right back reuses it.
+  base::OneShotTimer local_storage_release_timer_;
+
   WEB_CONTENTS_USER_DATA_KEY_DECL();
 };
 
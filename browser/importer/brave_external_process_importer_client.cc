@@ -99,6 +99,21 @@ void BraveExternalProcessImporterClient::OnImportItemFinished(
   brave_profile_import_->ReportImportItemFinished(import_item);
 }
 
+// The brave importer sends history and favicons in several batches, each
+// starting a new group, so rows from the previous batch must not be counted
+// again.
+void BraveExternalProcessImporterClient::OnHistoryImportStart(
+    uint32_t total_history_rows_count) {
+  history_rows_.clear();
+  ExternalProcessImporterClient::OnHistoryImportStart(total_history_rows_count);
+}
+
+void BraveExternalProcessImporterClient::OnFaviconsImportStart(
+    uint32_t total_favicons_count) {
+  favicons_.clear();
+  ExternalProcessImporterClient::OnFaviconsImportStart(total_favicons_count);
+}
+
 void BraveExternalProcessImporterClient::OnCreditCardImportReady(
     const base::string16& name_on_card,
     const base::string16& expiration_month,
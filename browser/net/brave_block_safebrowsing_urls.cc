@@ -5,8 +5,11 @@
 
 #include "brave/browser/net/brave_block_safebrowsing_urls.h"
 
+#include <algorithm>
 #include <vector>
 
+#include "base/no_destructor.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
 #include "url/gurl.h"
@@ -15,13 +18,19 @@ namespace brave {
 
 const char kDummyUrl[] = "https://no-thanks.invalid";
 
-bool IsSafeBrowsingReportingURL(const GURL& gurl) {
-  static const std::vector<URLPattern> allowed_patterns({
+namespace {
+
+const std::vector<URLPattern>& GetAllowedPatterns() {
+  static const base::NoDestructor<std::vector<URLPattern>> allowed_patterns({
       URLPattern(
           URLPattern::SCHEME_HTTPS,
           "https://sb-ssl.google.com/safebrowsing/clientreport/download*"),
   });
-  static const std::vector<URLPattern> reporting_patterns({
+  return *allowed_patterns;
+}
+
+const std::vector<URLPattern>& GetReportingPatterns() {
+  static const base::NoDestructor<std::vector<URLPattern>> reporting_patterns({
       URLPattern(URLPattern::SCHEME_HTTPS,
                  "https://sb-ssl.google.com/safebrowsing/clientreport/*"),
       URLPattern(URLPattern::SCHEME_HTTPS,
@@ -31,15 +40,41 @@ bool IsSafeBrowsingReportingURL(const GURL& gurl) {
       URLPattern(URLPattern::SCHEME_HTTPS,
                  "https://safebrowsing.google.com/safebrowsing/uploads/*"),
   });
+  return *reporting_patterns;
+}
 
-  if (std::any_of(
-          allowed_patterns.begin(), allowed_patterns.end(),
-          [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); })) {
+// Only reporting patterns are indexed, as allowed patterns are exceptions to
+// them
+const URLPatternHostIndex& GetReportingHostIndex() {
+  static const base::NoDestructor<URLPatternHostIndex> host_index([]() {
+    std::vector<const URLPattern*> patterns;
+    for (const auto& pattern : GetReportingPatterns()) {
+      patterns.push_back(&pattern);
+    }
+    return patterns;
+  }());
+  return *host_index;
+}
+
+bool MatchesAnyPattern(const GURL& gurl,
+                       const std::vector<URLPattern>& patterns) {
+  return std::any_of(
+      patterns.begin(), patterns.end(),
+      [&gurl](const URLPattern& pattern) { return pattern.MatchesURL(gurl); });
+}
+
+}  // namespace
+
+bool IsSafeBrowsingReportingURL(const GURL& gurl) {
+  if (GetReportingHostIndex().GetCandidates(gurl).none()) {
     return false;
   }
-  return std::any_of(
-      reporting_patterns.begin(), reporting_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+
+  if (MatchesAnyPattern(gurl, GetAllowedPatterns())) {
+    return false;
+  }
+
+  return MatchesAnyPattern(gurl, GetReportingPatterns());
 }
 
 int OnBeforeURLRequest_BlockSafeBrowsingReportingURLs(const GURL& request_url,
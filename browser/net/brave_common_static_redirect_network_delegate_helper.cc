@@ -5,14 +5,17 @@
 
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/common/network_constants.h"
 #include "brave/components/brave_component_updater/browser/features.h"
 #include "brave/components/brave_component_updater/browser/switches.h"
@@ -50,8 +53,8 @@ std::string GetUpdateURLHost() {
 // Update server checks happen from the profile context for admin policy
 // installed extensions. Update server checks happen from the system context for
 // normal update operations.
-bool IsUpdaterURL(const GURL& gurl) {
-  static std::vector<URLPattern> updater_patterns(
+const std::vector<URLPattern>& GetUpdaterPatterns() {
+  static const base::NoDestructor<std::vector<URLPattern>> updater_patterns(
       {URLPattern(URLPattern::SCHEME_HTTPS,
                   std::string(component_updater::kUpdaterJSONDefaultUrl) + "*"),
        URLPattern(
@@ -63,11 +66,25 @@ bool IsUpdaterURL(const GURL& gurl) {
            std::string(extension_urls::kChromeWebstoreUpdateURL) + "*")
 #endif
   });
+  return *updater_patterns;
+}
+
+bool IsUpdaterURL(const GURL& gurl) {
+  const std::vector<URLPattern>& updater_patterns = GetUpdaterPatterns();
   return std::any_of(
       updater_patterns.begin(), updater_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+      [&gurl](const URLPattern& pattern) { return pattern.MatchesURL(gurl); });
 }
 
+// Indexes of the common static redirect patterns in their URLPatternHostIndex.
+// The updater patterns follow |kUpdaterPatternsIndex|
+enum CommonStaticRedirectPatternIndex {
+  kChromeCastPatternIndex = 0,
+  kClients4PatternIndex,
+  kBugsChromiumPatternIndex,
+  kUpdaterPatternsIndex
+};
+
 bool RewriteBugReportingURL(const GURL& request_url, GURL* new_url) {
   GURL url("https://github.com/brave/brave-browser/issues/new");
   std::string query = "title=Crash%20Report&labels=crash";
@@ -124,7 +141,24 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
       URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
       "*://bugs.chromium.org/p/chromium/issues/entry?*");
 
-  if (IsUpdaterURL(request_url)) {
+  static const base::NoDestructor<URLPatternHostIndex> host_index([]() {
+    // Must be kept in the same order as |CommonStaticRedirectPatternIndex|
+    std::vector<const URLPattern*> patterns(
+        {&chromecast_pattern, &clients4_pattern, &bugsChromium_pattern});
+    for (const auto& updater_pattern : GetUpdaterPatterns()) {
+      patterns.push_back(&updater_pattern);
+    }
+    return patterns;
+  }());
+
+  const URLPatternHostIndex::Candidates candidates =
+      host_index->GetCandidates(request_url);
+  if (candidates.none()) {
+    return net::OK;
+  }
+
+  if ((candidates >> kUpdaterPatternsIndex).any() &&
+      IsUpdaterURL(request_url)) {
     auto update_host = GetUpdateURLHost();
     if (!update_host.empty()) {
       replacements.SetQueryStr(request_url.query_piece());
@@ -133,21 +167,24 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
     return net::OK;
   }
 
-  if (chromecast_pattern.MatchesURL(request_url)) {
+  if (candidates[kChromeCastPatternIndex] &&
+      chromecast_pattern.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveRedirectorProxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (clients4_pattern.MatchesHost(request_url)) {
+  if (candidates[kClients4PatternIndex] &&
+      clients4_pattern.MatchesHost(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveClients4Proxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (bugsChromium_pattern.MatchesURL(request_url)) {
+  if (candidates[kBugsChromiumPatternIndex] &&
+      bugsChromium_pattern.MatchesURL(request_url)) {
     if (RewriteBugReportingURL(request_url, new_url))
       return net::OK;
   }
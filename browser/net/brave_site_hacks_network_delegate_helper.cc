@@ -5,13 +5,14 @@
 
 #include "brave/browser/net/brave_site_hacks_network_delegate_helper.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
-#include <vector>
+#include <utility>
 
-#include "base/lazy_instance.h"
 #include "base/metrics/histogram_macros.h"
-#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/shield_exceptions.h"
@@ -23,60 +24,105 @@
 #include "net/url_request/url_request.h"
 #include "third_party/blink/public/common/loader/network_utils.h"
 #include "third_party/blink/public/common/loader/referrer_utils.h"
-#include "third_party/re2/src/re2/re2.h"
 
 namespace brave {
 
 namespace {
 
-const std::string& GetQueryStringTrackers() {
-  static const base::NoDestructor<std::string> trackers(base::JoinString(
-      std::vector<std::string>(
-          {// https://github.com/brave/brave-browser/issues/4239
-           "fbclid", "gclid", "msclkid", "mc_eid",
-           // https://github.com/brave/brave-browser/issues/9879
-           "dclid",
-           // https://github.com/brave/brave-browser/issues/11579
-           "_openstat",
-           // https://github.com/brave/brave-browser/issues/11817
-           "vero_conv", "vero_id",
-           // https://github.com/brave/brave-browser/issues/11578
-           "yclid",
-           // https://github.com/brave/brave-browser/issues/9019
-           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}),
-      "|"));
-  return *trackers;
+// Lower case and sorted, so that query keys can be looked up with a binary
+// search after being lower cased into a fixed size buffer
+constexpr base::StringPiece kQueryStringTrackers[] = {
+    // https://github.com/brave/brave-browser/issues/9019
+    "__hsfp", "__hssc", "__hstc", "_hsenc",
+    // https://github.com/brave/brave-browser/issues/11579
+    "_openstat",
+    // https://github.com/brave/brave-browser/issues/9879
+    "dclid",
+    // https://github.com/brave/brave-browser/issues/4239
+    "fbclid", "gclid",
+    // https://github.com/brave/brave-browser/issues/9019
+    "hsctatracking",
+    // https://github.com/brave/brave-browser/issues/4239
+    "mc_eid", "msclkid",
+    // https://github.com/brave/brave-browser/issues/11817
+    "vero_conv", "vero_id",
+    // https://github.com/brave/brave-browser/issues/11578
+    "yclid"};
+
+constexpr size_t kMaxQueryStringTrackerLength = 13;
+
+bool IsQueryStringTracker(const base::StringPiece& key) {
+  if (key.empty() || key.size() > kMaxQueryStringTrackerLength) {
+    return false;
+  }
+
+  char lower_case_key[kMaxQueryStringTrackerLength];
+  for (size_t i = 0; i < key.size(); i++) {
+    lower_case_key[i] = base::ToLowerASCII(key[i]);
+  }
+
+  return std::binary_search(std::begin(kQueryStringTrackers),
+                            std::end(kQueryStringTrackers),
+                            base::StringPiece(lower_case_key, key.size()));
+}
+
+// Returns true if |parameter| is a tracker with a value, e.g. "fbclid=1234"
+bool IsQueryStringTrackerParameter(const base::StringPiece& parameter) {
+  const size_t separator = parameter.find('=');
+  if (separator == base::StringPiece::npos ||
+      separator + 1 == parameter.size()) {
+    return false;
+  }
+
+  return IsQueryStringTracker(parameter.substr(0, separator));
 }
 
-// From src/components/autofill/content/renderer/page_passwords_analyser.cc
-// and password_form_conversion_utils.cc:
-#define DECLARE_LAZY_MATCHER(NAME, PATTERN)                                   \
-  struct LabelPatternLazyInstanceTraits_##NAME                                \
-      : public base::internal::DestructorAtExitLazyInstanceTraits<re2::RE2> { \
-    static re2::RE2* New(void* instance) {                                    \
-      re2::RE2::Options options;                                              \
-      options.set_case_sensitive(false);                                      \
-      re2::RE2* matcher = new (instance) re2::RE2(PATTERN, options);          \
-      DCHECK(matcher->ok());                                                  \
-      return matcher;                                                         \
-    }                                                                         \
-  };                                                                          \
-  base::LazyInstance<re2::RE2, LabelPatternLazyInstanceTraits_##NAME> NAME =  \
-      LAZY_INSTANCE_INITIALIZER
-
-// e.g. "?fbclid=1234"
-DECLARE_LAZY_MATCHER(tracker_only_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+$");
-
-// e.g. "?fbclid=1234&foo=1"
-DECLARE_LAZY_MATCHER(tracker_first_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+&");
-
-// e.g. "?foo=1&fbclid=1234" or "?foo=1&fbclid=1234&bar=2"
-DECLARE_LAZY_MATCHER(tracker_appended_matcher,
-                     "&(" + GetQueryStringTrackers() + ")=[^&]+");
-
-#undef DECLARE_LAZY_MATCHER
+// Walks the "&" separated parameters of |query| once and returns true if any
+// tracker was removed, in which case |filtered_query| is set to the remaining
+// parameters. Parameters are copied only once a tracker has been found
+bool FilterQueryStringTrackers(const base::StringPiece& query,
+                               std::string* filtered_query) {
+  DCHECK(filtered_query);
+
+  bool removed_tracker = false;
+  bool has_parameters = false;
+  size_t unfiltered_length = 0;
+
+  size_t start = 0;
+  while (start <= query.size()) {
+    size_t end = query.find('&', start);
+    if (end == base::StringPiece::npos) {
+      end = query.size();
+    }
+
+    const base::StringPiece parameter = query.substr(start, end - start);
+    start = end + 1;
+
+    if (IsQueryStringTrackerParameter(parameter)) {
+      if (!removed_tracker) {
+        removed_tracker = true;
+        filtered_query->reserve(query.size());
+        filtered_query->assign(query.data(), unfiltered_length);
+      }
+
+      continue;
+    }
+
+    if (!removed_tracker) {
+      unfiltered_length = end;
+      has_parameters = true;
+      continue;
+    }
+
+    if (has_parameters) {
+      filtered_query->push_back('&');
+    }
+    parameter.AppendToString(filtered_query);
+    has_parameters = true;
+  }
+
+  return removed_tracker;
+}
 
 void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.SiteHacks.QueryFilter");
@@ -102,23 +148,26 @@ void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
     return;
   }
 
-  std::string new_query = ctx->request_url.query();
-  // Note: the ordering of these replacements is important.
-  const int replacement_count =
-      re2::RE2::GlobalReplace(&new_query, tracker_appended_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_first_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_only_matcher.Get(), "");
-
-  if (replacement_count > 0) {
-    url::Replacements<char> replacements;
-    if (new_query.empty()) {
-      replacements.ClearQuery();
-    } else {
-      replacements.SetQuery(new_query.c_str(),
-                            url::Component(0, new_query.size()));
-    }
-    ctx->new_url_spec = ctx->request_url.ReplaceComponents(replacements).spec();
+  const std::string& spec = ctx->request_url.spec();
+  const url::Component query =
+      ctx->request_url.parsed_for_possibly_invalid_spec().query;
+
+  std::string new_query;
+  if (!FilterQueryStringTrackers(
+          base::StringPiece(spec).substr(query.begin, query.len),
+          &new_query)) {
+    return;
   }
+
+  // The filtered query is a subset of the canonical query, so it is spliced
+  // into the spec directly. The "?" is dropped along with an empty query
+  const size_t query_begin = new_query.empty() ? query.begin - 1 : query.begin;
+  std::string new_url_spec;
+  new_url_spec.reserve(spec.size());
+  new_url_spec.append(spec, 0, query_begin);
+  new_url_spec.append(new_query);
+  new_url_spec.append(spec, query.end(), std::string::npos);
+  ctx->new_url_spec = std::move(new_url_spec);
 }
 
 bool ApplyPotentialReferrerBlock(std::shared_ptr<BraveRequestInfo> ctx) {
@@ -297,3 +297,68 @@ TEST(BraveSiteHacksNetworkDelegateHelperTest, QueryStringFiltered) {
     EXPECT_EQ(brave_request_info->new_url_spec, "https://example.com/");
   }
 }
+
+TEST(BraveSiteHacksNetworkDelegateHelperTest, QueryStringTrackersFiltered) {
+  const std::vector<const std::string> trackers(
+      {"fbclid", "gclid", "msclkid", "mc_eid", "dclid", "_openstat",
+       "vero_conv", "vero_id", "yclid", "_hsenc", "__hssc", "__hstc",
+       "__hsfp", "hsCtaTracking", "FBCLID", "GClid", "hsctatracking"});
+  for (const auto& tracker : trackers) {
+    auto brave_request_info = std::make_shared<brave::BraveRequestInfo>(
+        GURL("https://example.com/?foo=1&" + tracker + "=2&bar=3"));
+    brave_request_info->initiator_url =
+        GURL("https://example.net");  // cross-site
+    int rc = brave::OnBeforeURLRequest_SiteHacksWork(ResponseCallback(),
+                                                     brave_request_info);
+    EXPECT_EQ(rc, net::OK);
+    EXPECT_EQ(brave_request_info->new_url_spec,
+              "https://example.com/?foo=1&bar=3");
+  }
+}
+
+TEST(BraveSiteHacksNetworkDelegateHelperTest, QueryStringCorpus) {
+  const std::vector<const std::pair<const std::string, const std::string>> urls(
+      {
+          // { original url, expected url after filtering, or empty if the
+          // url should be untouched }
+          {"https://www.google.com/search?q=brave+browser&oq=brave+browser&"
+           "aqs=chrome..69i57j0l7.2245j0j7&sourceid=chrome&ie=UTF-8",
+           ""},
+          {"https://www.youtube.com/watch?v=dQw4w9WgXcQ&list=PL1234&index=2&"
+           "t=42s",
+           ""},
+          {"https://www.amazon.com/dp/B08N5WRWNW/ref=sr_1_1?dchild=1&"
+           "keywords=laptop&qid=1604000000&sr=8-1",
+           ""},
+          {"https://example.com/article?utm_source=newsletter&utm_medium=email&"
+           "utm_campaign=fall&mc_cid=0123456789&mc_eid=abcdef0123",
+           "https://example.com/article?utm_source=newsletter&utm_medium=email&"
+           "utm_campaign=fall&mc_cid=0123456789"},
+          {"https://www.nytimes.com/2020/11/01/us/politics/story.html?"
+           "fbclid=IwAR2Vw7tXx0sGx1yY-ZpTqQ0bS7i8hZ3oK0wJrZpL0t9Xo5N6aT8z2c",
+           "https://www.nytimes.com/2020/11/01/us/politics/story.html"},
+          {"https://shop.example.com/product/1234?gclid=Cj0KCQjw3Nv3BRC8ARIsAPh"
+           "8hgJ2w_BwE&size=m&color=blue#reviews",
+           "https://shop.example.com/product/1234?size=m&color=blue#reviews"},
+          {"https://www.bing.com/aclk?ld=e8abc&u=aHR0cHM6Ly9leGFtcGxl&"
+           "msclkid=5f2b2b0c1a2b1c3d4e5f6a7b8c9d0e1f",
+           "https://www.bing.com/aclk?ld=e8abc&u=aHR0cHM6Ly9leGFtcGxl"},
+          {"https://blog.example.com/post?__hstc=20629287.1a2b3c.1604000000000."
+           "1604000000000.1604000000000.1&__hssc=20629287.1.1604000000000&"
+           "__hsfp=1234567890&_hsenc=p2ANqtz-8abc&hsCtaTracking=a1b2c3%7Cd4e5",
+           "https://blog.example.com/post"},
+          {"https://example.ru/news?_openstat=ZGlyZWN0LnlhbmRleC5ydTs&"
+           "yclid=1234567890123456789&id=42",
+           "https://example.ru/news?id=42"},
+      });
+  for (const auto& pair : urls) {
+    auto brave_request_info =
+        std::make_shared<brave::BraveRequestInfo>(GURL(pair.first));
+    brave_request_info->initiator_url =
+        GURL("https://example.net");  // cross-site
+    int rc = brave::OnBeforeURLRequest_SiteHacksWork(ResponseCallback(),
+                                                     brave_request_info);
+    EXPECT_EQ(rc, net::OK);
+    EXPECT_EQ(brave_request_info->new_url_spec, pair.second);
+  }
+}
@@ -10,7 +10,9 @@
 #include <string>
 #include <vector>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_piece_forward.h"
+#include "brave/browser/net/url_pattern_host_index.h"
 #include "brave/browser/translate/buildflags/buildflags.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/translate_network_constants.h"
@@ -31,6 +33,25 @@ base::StringPiece GetSafeBrowsingEndpoint() {
   return SAFEBROWSING_ENDPOINT;
 }
 
+// Indexes of the static redirect patterns in their URLPatternHostIndex
+enum StaticRedirectPatternIndex {
+  kGeoPatternIndex = 0,
+  kSafeBrowsingPatternIndex,
+  kSafeBrowsingFileCheckPatternIndex,
+  kCRXDownloadPatternIndex,
+  kAutofillPatternIndex,
+  kCRLSetPattern1Index,
+  kCRLSetPattern2Index,
+  kCRLSetPattern3Index,
+  kCRLSetPattern4Index,
+  kGvt1PatternIndex,
+  kGoogleDlPatternIndex,
+#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
+  kTranslatePatternIndex,
+  kTranslateLanguagePatternIndex,
+#endif
+};
+
 }  // namespace
 
 void SetSafeBrowsingEndpointForTesting(bool testing) {
@@ -92,68 +113,103 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
   static URLPattern translate_language_pattern(URLPattern::SCHEME_HTTPS,
       kTranslateLanguagePattern);
 #endif
-  if (geo_pattern.MatchesURL(request_url)) {
+
+  // Must be kept in the same order as |StaticRedirectPatternIndex|
+  static const base::NoDestructor<URLPatternHostIndex> host_index(
+      std::vector<const URLPattern*>({
+          &geo_pattern,
+          &safeBrowsing_pattern,
+          &safebrowsingfilecheck_pattern,
+          &crxDownload_pattern,
+          &autofill_pattern,
+          &crlSet_pattern1,
+          &crlSet_pattern2,
+          &crlSet_pattern3,
+          &crlSet_pattern4,
+          &gvt1_pattern,
+          &googleDl_pattern,
+#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
+          &translate_pattern,
+          &translate_language_pattern,
+#endif
+      }));
+
+  const URLPatternHostIndex::Candidates candidates =
+      host_index->GetCandidates(request_url);
+  if (candidates.none()) {
+    return net::OK;
+  }
+
+  if (candidates[kGeoPatternIndex] && geo_pattern.MatchesURL(request_url)) {
     *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
     return net::OK;
   }
 
   auto safebrowsing_endpoint = GetSafeBrowsingEndpoint();
   if (!safebrowsing_endpoint.empty() &&
+      candidates[kSafeBrowsingPatternIndex] &&
       safeBrowsing_pattern.MatchesHost(request_url)) {
     replacements.SetHostStr(safebrowsing_endpoint);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
+  if (candidates[kSafeBrowsingFileCheckPatternIndex] &&
+      safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
     replacements.SetHostStr(kBraveSafeBrowsingFileCheckProxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (crxDownload_pattern.MatchesURL(request_url)) {
+  if (candidates[kCRXDownloadPatternIndex] &&
+      crxDownload_pattern.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr("crxdownload.brave.com");
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (autofill_pattern.MatchesURL(request_url)) {
+  if (candidates[kAutofillPatternIndex] &&
+      autofill_pattern.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveStaticProxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (crlSet_pattern1.MatchesURL(request_url)) {
+  if (candidates[kCRLSetPattern1Index] &&
+      crlSet_pattern1.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr("crlsets.brave.com");
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (crlSet_pattern2.MatchesURL(request_url)) {
+  if (candidates[kCRLSetPattern2Index] &&
+      crlSet_pattern2.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr("crlsets.brave.com");
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (crlSet_pattern3.MatchesURL(request_url)) {
+  if (candidates[kCRLSetPattern3Index] &&
+      crlSet_pattern3.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr("crlsets.brave.com");
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (crlSet_pattern4.MatchesURL(request_url)) {
+  if (candidates[kCRLSetPattern4Index] &&
+      crlSet_pattern4.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr("crlsets.brave.com");
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (gvt1_pattern.MatchesURL(request_url) &&
+  if (candidates[kGvt1PatternIndex] && gvt1_pattern.MatchesURL(request_url) &&
       !widevine_gvt1_pattern.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveRedirectorProxy);
@@ -161,7 +217,8 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     return net::OK;
   }
 
-  if (googleDl_pattern.MatchesURL(request_url) &&
+  if (candidates[kGoogleDlPatternIndex] &&
+      googleDl_pattern.MatchesURL(request_url) &&
       !widevine_google_dl_pattern.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveRedirectorProxy);
@@ -170,7 +227,8 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
   }
 
 #if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
-  if (translate_pattern.MatchesURL(request_url)) {
+  if (candidates[kTranslatePatternIndex] &&
+      translate_pattern.MatchesURL(request_url)) {
     replacements.SetQueryStr(request_url.query_piece());
     replacements.SetPathStr(request_url.path_piece());
     *new_url =
@@ -178,7 +236,8 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     return net::OK;
   }
 
-  if (translate_language_pattern.MatchesURL(request_url)) {
+  if (candidates[kTranslateLanguagePatternIndex] &&
+      translate_language_pattern.MatchesURL(request_url)) {
     *new_url = GURL(kBraveTranslateLanguageEndpoint);
     return net::OK;
   }
@@ -10,6 +10,7 @@
 
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/browser/brave_shields_web_contents_observer.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
 #include "brave/components/brave_webtorrent/browser/webtorrent_util.h"
 #include "brave/components/ipfs/buildflags/buildflags.h"
@@ -121,20 +122,24 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
 
   Profile* profile = Profile::FromBrowserContext(browser_context);
   auto* map = HostContentSettingsMapFactory::GetForProfile(profile);
-  ctx->allow_brave_shields =
-      brave_shields::GetBraveShieldsEnabled(map, ctx->tab_origin);
-  ctx->allow_ads = brave_shields::GetAdControlType(
-      map, ctx->tab_origin) == brave_shields::ControlType::ALLOW;
+  const brave_shields::ShieldsSettingsSnapshot shields_settings =
+      brave_shields::BraveShieldsWebContentsObserver::
+          GetShieldsSettingsFromRenderFrameInfo(
+              map, ctx->tab_origin, ctx->render_process_id,
+              ctx->render_frame_id, ctx->frame_tree_node_id);
+  ctx->allow_brave_shields = shields_settings.brave_shields_enabled();
+  ctx->allow_ads = shields_settings.allow_ads();
   ctx->allow_http_upgradable_resource =
-      !brave_shields::GetHTTPSEverywhereEnabled(map, ctx->tab_origin);
+      !shields_settings.https_everywhere_enabled();
 
   // HACK: after we fix multiple creations of BraveRequestInfo we should
   // use only tab_origin. Since we recreate BraveRequestInfo during consequent
   // stages of navigation, |tab_origin| changes and so does |allow_referrers|
   // flag, which is not what we want for determining referrers.
-  ctx->allow_referrers = brave_shields::AllowReferrers(
-      map, ctx->redirect_source.is_empty() ? ctx->tab_origin :
-                                             ctx->redirect_source);
+  ctx->allow_referrers =
+      ctx->redirect_source.is_empty()
+          ? shields_settings.allow_referrers()
+          : brave_shields::AllowReferrers(map, ctx->redirect_source);
   ctx->upload_data = GetUploadData(request);
 
 #if BUILDFLAG(IPFS_ENABLED)
@@ -0,0 +1,88 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include "base/logging.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "extensions/common/url_pattern.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+URLPatternHostIndex::Candidates FindCandidates(
+    const base::flat_map<std::string,
+                         URLPatternHostIndex::Candidates,
+                         std::less<>>& host_map,
+    base::StringPiece host) {
+  const auto iter = host_map.find(host);
+  if (iter == host_map.end()) {
+    return URLPatternHostIndex::Candidates();
+  }
+
+  return iter->second;
+}
+
+}  // namespace
+
+URLPatternHostIndex::URLPatternHostIndex(
+    const std::vector<const URLPattern*>& patterns) {
+  DCHECK_LE(patterns.size(), kMaxPatterns);
+
+  for (size_t i = 0; i < patterns.size(); i++) {
+    const URLPattern* pattern = patterns[i];
+    DCHECK(pattern);
+
+    if (pattern->match_all_urls() || pattern->host().empty()) {
+      any_host_.set(i);
+      continue;
+    }
+
+    const std::string host = base::ToLowerASCII(pattern->host());
+    if (pattern->match_subdomains()) {
+      domains_[host].set(i);
+    } else {
+      hosts_[host].set(i);
+    }
+  }
+}
+
+URLPatternHostIndex::~URLPatternHostIndex() = default;
+
+URLPatternHostIndex::Candidates URLPatternHostIndex::GetCandidates(
+    const GURL& url) const {
+  Candidates candidates = any_host_;
+
+  base::StringPiece host = url.host_piece();
+  // URLPattern ignores a trailing dot, e.g. "example.com."
+  if (!host.empty() && host.back() == '.') {
+    host.remove_suffix(1);
+  }
+
+  if (host.empty()) {
+    return candidates;
+  }
+
+  candidates |= FindCandidates(hosts_, host);
+
+  // Look up the host and each of its parent domains
+  while (true) {
+    candidates |= FindCandidates(domains_, host);
+
+    const size_t separator = host.find('.');
+    if (separator == base::StringPiece::npos) {
+      break;
+    }
+
+    host.remove_prefix(separator + 1);
+  }
+
+  return candidates;
+}
+
+}  // namespace brave
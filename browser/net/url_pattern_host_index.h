@@ -0,0 +1,55 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+#define BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+
+#include <bitset>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/macros.h"
+
+class GURL;
+class URLPattern;
+
+namespace brave {
+
+// Indexes a fixed list of URLPatterns by the hosts they can match, so that a
+// request only has to be matched against the patterns which apply to its host.
+// Requests to hosts which are not covered by any pattern are rejected after
+// one lookup per host label, without running URLPattern::MatchesURL
+class URLPatternHostIndex {
+ public:
+  static constexpr size_t kMaxPatterns = 32;
+
+  // Bit |i| is set if the pattern at index |i| may match the request
+  using Candidates = std::bitset<kMaxPatterns>;
+
+  explicit URLPatternHostIndex(const std::vector<const URLPattern*>& patterns);
+  ~URLPatternHostIndex();
+
+  // Returns the patterns whose host matches the host of |url|. The scheme,
+  // path and query of |url| still have to be matched against each candidate
+  Candidates GetCandidates(const GURL& url) const;
+
+ private:
+  using HostMap = base::flat_map<std::string, Candidates, std::less<>>;
+
+  // Patterns matching the exact host
+  HostMap hosts_;
+  // Patterns matching the host and all of its subdomains
+  HostMap domains_;
+  // Patterns matching any host
+  Candidates any_host_;
+
+  DISALLOW_COPY_AND_ASSIGN(URLPatternHostIndex);
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
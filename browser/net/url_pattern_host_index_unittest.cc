@@ -0,0 +1,103 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include <vector>
+
+#include "extensions/common/url_pattern.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+const URLPattern kExactHostPattern(URLPattern::SCHEME_HTTPS,
+                                   "https://www.example.com/path*");
+const URLPattern kSubdomainsPattern(URLPattern::SCHEME_ALL,
+                                    "*://*.example.com/*");
+const URLPattern kOtherHostPattern(URLPattern::SCHEME_HTTPS,
+                                   "https://brave.com/*");
+const URLPattern kAllHostsPattern(URLPattern::SCHEME_HTTP, "http://*/*");
+
+URLPatternHostIndex::Candidates GetCandidates(const std::vector<int>& bits) {
+  URLPatternHostIndex::Candidates candidates;
+  for (const int bit : bits) {
+    candidates.set(bit);
+  }
+  return candidates;
+}
+
+}  // namespace
+
+TEST(URLPatternHostIndexTest, NoCandidatesForUnknownHost) {
+  const URLPatternHostIndex index(
+      {&kExactHostPattern, &kSubdomainsPattern, &kOtherHostPattern});
+
+  EXPECT_TRUE(index.GetCandidates(GURL("https://example.org/")).none());
+  EXPECT_TRUE(index.GetCandidates(GURL("https://notexample.com/")).none());
+  EXPECT_TRUE(index.GetCandidates(GURL("https://sub.brave.com/")).none());
+  EXPECT_TRUE(index.GetCandidates(GURL("file:///etc/hosts")).none());
+}
+
+TEST(URLPatternHostIndexTest, ExactHost) {
+  const URLPatternHostIndex index({&kExactHostPattern, &kOtherHostPattern});
+
+  EXPECT_EQ(GetCandidates({0}),
+            index.GetCandidates(GURL("https://www.example.com/other")));
+  EXPECT_EQ(GetCandidates({1}),
+            index.GetCandidates(GURL("https://brave.com/")));
+  EXPECT_EQ(GetCandidates({1}),
+            index.GetCandidates(GURL("https://brave.com./")));
+  EXPECT_TRUE(index.GetCandidates(GURL("https://example.com/")).none());
+}
+
+TEST(URLPatternHostIndexTest, Subdomains) {
+  const URLPatternHostIndex index({&kExactHostPattern, &kSubdomainsPattern});
+
+  EXPECT_EQ(GetCandidates({1}),
+            index.GetCandidates(GURL("https://example.com/")));
+  EXPECT_EQ(GetCandidates({0, 1}),
+            index.GetCandidates(GURL("https://www.example.com/")));
+  EXPECT_EQ(GetCandidates({1}),
+            index.GetCandidates(GURL("https://a.b.example.com/")));
+}
+
+TEST(URLPatternHostIndexTest, AllHosts) {
+  const URLPatternHostIndex index({&kOtherHostPattern, &kAllHostsPattern});
+
+  EXPECT_EQ(GetCandidates({1}),
+            index.GetCandidates(GURL("http://example.org/")));
+  EXPECT_EQ(GetCandidates({0, 1}),
+            index.GetCandidates(GURL("https://brave.com/")));
+}
+
+TEST(URLPatternHostIndexTest, CandidatesAreSupersetOfMatches) {
+  const std::vector<const URLPattern*> patterns(
+      {&kExactHostPattern, &kSubdomainsPattern, &kOtherHostPattern,
+       &kAllHostsPattern});
+  const URLPatternHostIndex index(patterns);
+
+  const char* urls[] = {
+      "https://www.example.com/path", "http://example.com/",
+      "https://brave.com/index.html", "http://brave.com/",
+      "https://WWW.EXAMPLE.COM/path", "http://127.0.0.1/",
+      "https://example.org/",         "data:text/plain,example.com",
+  };
+
+  for (const char* url : urls) {
+    const GURL gurl(url);
+    const URLPatternHostIndex::Candidates candidates =
+        index.GetCandidates(gurl);
+    for (size_t i = 0; i < patterns.size(); i++) {
+      if (patterns[i]->MatchesURL(gurl)) {
+        EXPECT_TRUE(candidates[i]) << url << " " << i;
+      }
+    }
+  }
+}
+
+}  // namespace brave
@@ -6,6 +6,7 @@
 #include "brave/browser/speedreader/speedreader_service_factory.h"
 
 #include "brave/components/speedreader/speedreader_service.h"
+#include "brave/components/weekly_storage/weekly_storage_service_factory.h"
 #include "chrome/browser/profiles/incognito_helpers.h"
 #include "chrome/browser/profiles/profile.h"
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
@@ -26,7 +27,9 @@ SpeedreaderService* SpeedreaderServiceFactory::GetForProfile(Profile* profile) {
 SpeedreaderServiceFactory::SpeedreaderServiceFactory()
     : BrowserContextKeyedServiceFactory(
           "SpeedreaderService",
-          BrowserContextDependencyManager::GetInstance()) {}
+          BrowserContextDependencyManager::GetInstance()) {
+  DependsOn(WeeklyStorageServiceFactory::GetInstance());
+}
 
 SpeedreaderServiceFactory::~SpeedreaderServiceFactory() {}
 
@@ -39,7 +42,8 @@ SpeedreaderServiceFactory::GetBrowserContextToUse(
 KeyedService* SpeedreaderServiceFactory::BuildServiceInstanceFor(
     content::BrowserContext* context) const {
   return new SpeedreaderService(
-      Profile::FromBrowserContext(context)->GetPrefs());
+      Profile::FromBrowserContext(context)->GetPrefs(),
+      WeeklyStorageServiceFactory::GetForBrowserContext(context));
 }
 
 bool SpeedreaderServiceFactory::ServiceIsCreatedWithBrowserContext() const {
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include <map>
 #include <utility>
 #include <memory>
 #include <string>
@@ -14,7 +15,9 @@
 
 #include "base/i18n/time_formatting.h"
 #include "base/memory/weak_ptr.h"
+#include "base/optional.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/common/webui_url_constants.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
@@ -79,6 +82,8 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void GetReconcileStamp(const base::ListValue* args);
   void SaveSetting(const base::ListValue* args);
   void OnPublisherList(ledger::type::PublisherInfoList list);
+  void OnPublisherListChanged(ledger::type::PublisherInfoList list);
+  void SendPendingPublisherListChanges();
   void OnExcludedSiteList(ledger::type::PublisherInfoList list);
   void ExcludePublisher(const base::ListValue* args);
   void RestorePublishers(const base::ListValue* args);
@@ -301,6 +306,13 @@ class RewardsDOMHandler : public WebUIMessageHandler,
 
   brave_rewards::RewardsService* rewards_service_;  // NOT OWNED
   brave_ads::AdsService* ads_service_;  // NOT OWNED
+
+  // Auto-contribute publishers last sent to the page, keyed by publisher id,
+  // so that renormalizations only send the rows which changed
+  std::map<std::string, base::Value> contribute_list_;
+  base::Optional<ledger::type::PublisherInfoList> pending_publisher_list_;
+  base::OneShotTimer publisher_list_timer_;
+
   base::WeakPtrFactory<RewardsDOMHandler> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(RewardsDOMHandler);
@@ -310,12 +322,29 @@ namespace {
 
 const int kDaysOfAdsHistory = 7;
 
+// Minimum interval between two publisher list updates sent to the page
+const int kPublisherListUpdateIntervalSeconds = 2;
+
 const char kShouldAllowAdsSubdivisionTargeting[] =
     "shouldAllowAdsSubdivisionTargeting";
 const char kAdsSubdivisionTargeting[] = "adsSubdivisionTargeting";
 const char kAutoDetectedAdsSubdivisionTargeting[] =
     "automaticallyDetectedAdsSubdivisionTargeting";
 
+base::Value PublisherToValue(const ledger::type::PublisherInfo& info) {
+  base::Value publisher(base::Value::Type::DICTIONARY);
+  publisher.SetStringKey("id", info.id);
+  publisher.SetDoubleKey("percentage", info.percent);
+  publisher.SetStringKey("publisherKey", info.id);
+  publisher.SetIntKey("status", static_cast<int>(info.status));
+  publisher.SetIntKey("excluded", static_cast<int>(info.excluded));
+  publisher.SetStringKey("name", info.name);
+  publisher.SetStringKey("provider", info.provider);
+  publisher.SetStringKey("url", info.url);
+  publisher.SetStringKey("favIcon", info.favicon_url);
+  return publisher;
+}
+
 }  // namespace
 
 RewardsDOMHandler::RewardsDOMHandler() : weak_factory_(this) {}
@@ -903,24 +932,76 @@ void RewardsDOMHandler::OnPublisherList(ledger::type::PublisherInfoList list) {
     return;
   }
 
-  auto publishers = std::make_unique<base::ListValue>();
+  contribute_list_.clear();
+
+  base::Value publishers(base::Value::Type::LIST);
   for (auto const& item : list) {
-    auto publisher = std::make_unique<base::DictionaryValue>();
-    publisher->SetString("id", item->id);
-    publisher->SetDouble("percentage", item->percent);
-    publisher->SetString("publisherKey", item->id);
-    publisher->SetInteger("status", static_cast<int>(item->status));
-    publisher->SetInteger("excluded", static_cast<int>(item->excluded));
-    publisher->SetString("name", item->name);
-    publisher->SetString("provider", item->provider);
-    publisher->SetString("url", item->url);
-    publisher->SetString("favIcon", item->favicon_url);
-    publishers->Append(std::move(publisher));
+    base::Value publisher = PublisherToValue(*item);
+    contribute_list_[item->id] = publisher.Clone();
+    publishers.Append(std::move(publisher));
   }
 
   web_ui()->CallJavascriptFunctionUnsafe(
       "brave_rewards.contributeList",
-      *publishers);
+      publishers);
+}
+
+void RewardsDOMHandler::OnPublisherListChanged(
+    ledger::type::PublisherInfoList list) {
+  if (!web_ui()->CanCallJavascript()) {
+    return;
+  }
+
+  std::map<std::string, base::Value> contribute_list;
+  base::Value updated(base::Value::Type::LIST);
+  for (auto const& item : list) {
+    base::Value publisher = PublisherToValue(*item);
+
+    const auto iter = contribute_list_.find(item->id);
+    if (iter == contribute_list_.end() || iter->second != publisher) {
+      updated.Append(publisher.Clone());
+    }
+
+    contribute_list[item->id] = std::move(publisher);
+  }
+
+  base::Value removed(base::Value::Type::LIST);
+  for (const auto& publisher : contribute_list_) {
+    if (contribute_list.find(publisher.first) == contribute_list.end()) {
+      removed.Append(publisher.first);
+    }
+  }
+
+  contribute_list_ = std::move(contribute_list);
+
+  if (updated.GetList().empty() && removed.GetList().empty()) {
+    return;
+  }
+
+  base::Value changes(base::Value::Type::DICTIONARY);
+  changes.SetKey("updated", std::move(updated));
+  changes.SetKey("removed", std::move(removed));
+
+  web_ui()->CallJavascriptFunctionUnsafe(
+      "brave_rewards.contributeListChanged",
+      changes);
+}
+
+void RewardsDOMHandler::SendPendingPublisherListChanges() {
+  if (!pending_publisher_list_) {
+    return;
+  }
+
+  ledger::type::PublisherInfoList list = std::move(*pending_publisher_list_);
+  pending_publisher_list_.reset();
+  OnPublisherListChanged(std::move(list));
+
+  // Changes arriving before the timer fires are sent together when it does
+  publisher_list_timer_.Start(
+      FROM_HERE,
+      base::TimeDelta::FromSeconds(kPublisherListUpdateIntervalSeconds),
+      base::BindOnce(&RewardsDOMHandler::SendPendingPublisherListChanges,
+          base::Unretained(this)));
 }
 
 void RewardsDOMHandler::OnExcludedSiteList(
@@ -1362,7 +1443,12 @@ void RewardsDOMHandler::OnPendingContributionSaved(
 void RewardsDOMHandler::OnPublisherListNormalized(
     brave_rewards::RewardsService* rewards_service,
     ledger::type::PublisherInfoList list) {
-  OnPublisherList(std::move(list));
+  pending_publisher_list_ = std::move(list);
+  if (publisher_list_timer_.IsRunning()) {
+    return;
+  }
+
+  SendPendingPublisherListChanges();
 }
 
 void RewardsDOMHandler::GetTransactionHistory(
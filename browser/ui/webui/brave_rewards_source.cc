@@ -7,26 +7,35 @@
 
 #include <utility>
 
-#include "base/memory/ref_counted_memory.h"
+#include "base/bind.h"
+#include "base/task/post_task.h"
+#include "base/task/task_traits.h"
 #include "chrome/browser/bitmap_fetcher/bitmap_fetcher_service.h"
 #include "chrome/browser/bitmap_fetcher/bitmap_fetcher_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/gfx/codec/png_codec.h"
-#include "url/gurl.h"
 
 namespace {
 
-scoped_refptr<base::RefCountedMemory> BitmapToMemory(const SkBitmap* image) {
-  base::RefCountedBytes* image_bytes = new base::RefCountedBytes;
-  gfx::PNGCodec::EncodeBGRASkBitmap(*image, false, &image_bytes->data());
+// The rewards page shows a favicon for every publisher in its lists, so keep
+// enough images around for reopening it not to fetch them all again. Entries
+// expire so that a publisher changing its image is picked up.
+const size_t kMaxCachedImagesSize = 5 * 1024 * 1024;
+constexpr base::TimeDelta kCachedImageExpiry = base::TimeDelta::FromHours(1);
+
+scoped_refptr<base::RefCountedMemory> BitmapToMemory(const SkBitmap& image) {
+  scoped_refptr<base::RefCountedBytes> image_bytes =
+      base::MakeRefCounted<base::RefCountedBytes>();
+  gfx::PNGCodec::EncodeBGRASkBitmap(image, false, &image_bytes->data());
   return image_bytes;
 }
 
 }  // namespace
 
 BraveRewardsSource::BraveRewardsSource(Profile* profile)
-    : profile_(profile->GetOriginalProfile()) {}
+    : profile_(profile->GetOriginalProfile()),
+      image_cache_(ImageCache::NO_AUTO_EVICT) {}
 
 BraveRewardsSource::~BraveRewardsSource() {
 }
@@ -48,11 +57,21 @@ void BraveRewardsSource::StartDataRequest(
     return;
   }
 
-  auto it =
-      find(resource_fetchers_.begin(), resource_fetchers_.end(), actual_url);
-  if (it != resource_fetchers_.end()) {
-    LOG(WARNING) << "Already fetching specified Brave Rewards resource, url: "
-                 << actual_url;
+  const auto cache_iter = image_cache_.Get(actual_url);
+  if (cache_iter != image_cache_.end()) {
+    if (base::TimeTicks::Now() - cache_iter->second.cached_at <
+        kCachedImageExpiry) {
+      std::move(got_data_callback).Run(cache_iter->second.image.get());
+      return;
+    }
+
+    image_cache_size_ -= cache_iter->second.image->size();
+    image_cache_.Erase(cache_iter);
+  }
+
+  auto pending_iter = pending_requests_.find(actual_url);
+  if (pending_iter != pending_requests_.end()) {
+    pending_iter->second.push_back(std::move(got_data_callback));
     return;
   }
 
@@ -78,14 +97,16 @@ void BraveRewardsSource::StartDataRequest(
           policy_exception_justification:
             "Not implemented."
         })");
-    resource_fetchers_.emplace_back(actual_url);
+    pending_requests_[actual_url].push_back(std::move(got_data_callback));
     image_service->RequestImage(
         actual_url,
         base::BindOnce(&BraveRewardsSource::OnBitmapFetched,
-                       base::Unretained(this), std::move(got_data_callback),
-                       actual_url),
+                       weak_factory_.GetWeakPtr(), actual_url),
         traffic_annotation);
+    return;
   }
+
+  std::move(got_data_callback).Run(nullptr);
 }
 
 std::string BraveRewardsSource::GetMimeType(const std::string&) {
@@ -113,20 +134,66 @@ bool BraveRewardsSource::ShouldServiceRequest(
 }
 
 void BraveRewardsSource::OnBitmapFetched(
-    content::URLDataSource::GotDataCallback got_data_callback,
     const GURL& url,
     const SkBitmap& bitmap) {
   if (bitmap.isNull()) {
     LOG(ERROR) << "Failed to retrieve Brave Rewards resource, url: " << url;
-    std::move(got_data_callback).Run(nullptr);
+    RunPendingRequests(url, nullptr);
+    return;
+  }
+
+  base::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::ThreadPool(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&BitmapToMemory, bitmap),
+      base::BindOnce(&BraveRewardsSource::OnBitmapEncoded,
+                     weak_factory_.GetWeakPtr(), url));
+}
+
+void BraveRewardsSource::OnBitmapEncoded(
+    const GURL& url,
+    scoped_refptr<base::RefCountedMemory> image) {
+  CacheImage(url, image);
+  RunPendingRequests(url, image);
+}
+
+void BraveRewardsSource::CacheImage(
+    const GURL& url,
+    scoped_refptr<base::RefCountedMemory> image) {
+  const auto iter = image_cache_.Peek(url);
+  if (iter != image_cache_.end()) {
+    image_cache_size_ -= iter->second.image->size();
+    image_cache_.Erase(iter);
+  }
+
+  if (!image || image->size() > kMaxCachedImagesSize) {
+    return;
+  }
+
+  image_cache_size_ += image->size();
+  image_cache_.Put(url, CachedImage{image, base::TimeTicks::Now()});
+
+  while (image_cache_size_ > kMaxCachedImagesSize) {
+    const auto oldest_iter = image_cache_.rbegin();
+    image_cache_size_ -= oldest_iter->second.image->size();
+    image_cache_.Erase(oldest_iter);
+  }
+}
+
+void BraveRewardsSource::RunPendingRequests(
+    const GURL& url,
+    scoped_refptr<base::RefCountedMemory> image) {
+  auto iter = pending_requests_.find(url);
+  if (iter == pending_requests_.end()) {
     return;
   }
 
-  std::move(got_data_callback).Run(BitmapToMemory(&bitmap).get());
+  std::vector<content::URLDataSource::GotDataCallback> callbacks =
+      std::move(iter->second);
+  pending_requests_.erase(iter);
 
-  auto it_url =
-      find(resource_fetchers_.begin(), resource_fetchers_.end(), url);
-  if (it_url != resource_fetchers_.end()) {
-    resource_fetchers_.erase(it_url);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(image.get());
   }
 }
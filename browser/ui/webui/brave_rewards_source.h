@@ -6,14 +6,19 @@
 #ifndef BRAVE_BROWSER_UI_WEBUI_BRAVE_REWARDS_SOURCE_H_
 #define BRAVE_BROWSER_UI_WEBUI_BRAVE_REWARDS_SOURCE_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
 #include "base/macros.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "chrome/browser/bitmap_fetcher/bitmap_fetcher_service.h"
 #include "content/public/browser/url_data_source.h"
+#include "url/gurl.h"
 
-class GURL;
 class Profile;
 class SkBitmap;
 
@@ -38,13 +43,42 @@ class BraveRewardsSource : public content::URLDataSource {
                             int render_process_id) override;
 
  private:
+  struct CachedImage {
+    scoped_refptr<base::RefCountedMemory> image;
+    base::TimeTicks cached_at;
+  };
+
+  using ImageCache = base::MRUCache<GURL, CachedImage>;
+
   void OnBitmapFetched(
-      content::URLDataSource::GotDataCallback got_data_callback,
       const GURL& url,
       const SkBitmap& bitmap);
 
+  void OnBitmapEncoded(
+      const GURL& url,
+      scoped_refptr<base::RefCountedMemory> image);
+
+  void RunPendingRequests(
+      const GURL& url,
+      scoped_refptr<base::RefCountedMemory> image);
+
+  void CacheImage(
+      const GURL& url,
+      scoped_refptr<base::RefCountedMemory> image);
+
   Profile* profile_;
-  std::vector<GURL> resource_fetchers_;
+
+  // Callbacks of the requests waiting on an in-flight fetch, keyed by the
+  // image URL. Concurrent requests for the same URL share one fetch.
+  std::map<GURL, std::vector<content::URLDataSource::GotDataCallback>>
+      pending_requests_;
+
+  // Recently served PNG-encoded images, keyed by the image URL. The cache is
+  // bounded by the total size of the encoded images in |image_cache_size_|.
+  ImageCache image_cache_;
+  size_t image_cache_size_ = 0;
+
+  base::WeakPtrFactory<BraveRewardsSource> weak_factory_{this};
 
   DISALLOW_COPY_AND_ASSIGN(BraveRewardsSource);
 };
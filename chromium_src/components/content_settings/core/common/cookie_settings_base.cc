@@ -5,6 +5,11 @@
 
 #include "components/content_settings/core/common/cookie_settings_base.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
 #include "base/feature_list.h"
 #include "base/no_destructor.h"
 #include "base/optional.h"
@@ -38,105 +43,88 @@ constexpr char kBitbucket[] = "https://[*.]bitbucket.org/*";
 constexpr char kAtlassiannet[] = "https://[*.]atlassian.net/*";
 constexpr char kAtlassiancom[] = "https://[*.]atlassian.com/*";
 
+// Third-party urls which are allowed to use cookies when embedded in a first
+// party of the same entity, keyed by the registrable domains of both.
+struct AllowedThirdParty {
+  const char* domain;
+  const char* pattern;
+  const char* first_party_domain;
+  const char* first_party_pattern;
+};
+
+constexpr AllowedThirdParty kEntityList[] = {
+    {"wp.com", kWp, "wordpress.com", kWordpress},
+    {"wordpress.com", kWordpress, "wp.com", kWp},
+    {"google.com", kGoogle, "googleusercontent.com", kGoogleusercontent},
+    {"googleusercontent.com", kGoogleusercontent, "google.com", kGoogle},
+    {"playstation.com", kPlaystation, "sonyentertainmentnetwork.com",
+     kSonyentertainmentnetwork},
+    {"sonyentertainmentnetwork.com", kSonyentertainmentnetwork,
+     "playstation.com", kPlaystation},
+    {"sony.com", kSony, "playstation.com", kPlaystation},
+    {"playstation.com", kPlaystation, "sony.com", kSony},
+    {"ubisoft.com", kUbisoft, "ubi.com", kUbi},
+    {"ubi.com", kUbi, "ubisoft.com", kUbisoft},
+    {"americanexpress.com", kAmericanexpress, "aexp-static.com", kAexp},
+    {"aexp-static.com", kAexp, "americanexpress.com", kAmericanexpress},
+    {"twitch.tv", kTwitch, "reddit.com", kReddit},
+    {"twitch.tv", kTwitch, "discord.com", kDiscord},
+    {"bitbucket.org", kBitbucket, "atlassian.com", kAtlassiancom},
+    {"atlassian.com", kAtlassiancom, "bitbucket.org", kBitbucket},
+    {"atlassian.com", kAtlassiancom, "atlassian.net", kAtlassiannet},
+    {"atlassian.net", kAtlassiannet, "atlassian.com", kAtlassiancom},
+};
+
+using PatternPairs =
+    std::vector<std::pair<ContentSettingsPattern, ContentSettingsPattern>>;
+
+// domain -> first party domain -> (url, first_party_url) allowed patterns
+using EntityMap = base::flat_map<std::string,
+                                 base::flat_map<std::string, PatternPairs>>;
+
+const EntityMap& GetEntityMap() {
+  static const base::NoDestructor<EntityMap> entity_map([] {
+    EntityMap entity_map;
+    for (const auto& entry : kEntityList) {
+      entity_map[entry.domain][entry.first_party_domain].emplace_back(
+          ContentSettingsPattern::FromString(entry.pattern),
+          ContentSettingsPattern::FromString(entry.first_party_pattern));
+    }
+    return entity_map;
+  }());
+  return *entity_map;
+}
+
+std::string GetRegistrableDomain(const GURL& url) {
+  return net::registry_controlled_domains::GetDomainAndRegistry(
+      url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+}
+
 bool BraveIsAllowedThirdParty(
     const GURL& url,
     const GURL& site_for_cookies,
     const base::Optional<url::Origin>& top_frame_origin) {
-  static const base::NoDestructor<
-      // url -> first_party_url allow map
-      std::vector<std::pair<ContentSettingsPattern,
-                            ContentSettingsPattern>>> entity_list({
-          {
-            ContentSettingsPattern::FromString(kWp),
-            ContentSettingsPattern::FromString(kWordpress)
-          },
-          {
-            ContentSettingsPattern::FromString(kWordpress),
-            ContentSettingsPattern::FromString(kWp)
-          },
-          {
-            ContentSettingsPattern::FromString(kGoogle),
-            ContentSettingsPattern::FromString(kGoogleusercontent)
-          },
-          {
-            ContentSettingsPattern::FromString(kGoogleusercontent),
-            ContentSettingsPattern::FromString(kGoogle)
-          },
-          {
-            ContentSettingsPattern::FromString(kPlaystation),
-            ContentSettingsPattern::FromString(kSonyentertainmentnetwork)
-          },
-          {
-            ContentSettingsPattern::FromString(kSonyentertainmentnetwork),
-            ContentSettingsPattern::FromString(kPlaystation)
-          },
-          {
-            ContentSettingsPattern::FromString(kSony),
-            ContentSettingsPattern::FromString(kPlaystation)
-          },
-          {
-            ContentSettingsPattern::FromString(kPlaystation),
-            ContentSettingsPattern::FromString(kSony)
-          },
-          {
-            ContentSettingsPattern::FromString(kUbisoft),
-            ContentSettingsPattern::FromString(kUbi)
-          },
-          {
-            ContentSettingsPattern::FromString(kUbi),
-            ContentSettingsPattern::FromString(kUbisoft)
-          },
-          {
-            ContentSettingsPattern::FromString(kAmericanexpress),
-            ContentSettingsPattern::FromString(kAexp)
-          },
-          {
-            ContentSettingsPattern::FromString(kAexp),
-            ContentSettingsPattern::FromString(kAmericanexpress)
-          },
-          {
-            ContentSettingsPattern::FromString(kTwitch),
-            ContentSettingsPattern::FromString(kReddit)
-          },
-          {
-            ContentSettingsPattern::FromString(kTwitch),
-            ContentSettingsPattern::FromString(kDiscord)
-          },
-          {
-            ContentSettingsPattern::FromString(kBitbucket),
-            ContentSettingsPattern::FromString(kAtlassiancom)
-          },
-          {
-            ContentSettingsPattern::FromString(kAtlassiancom),
-            ContentSettingsPattern::FromString(kBitbucket)
-          },
-          {
-            ContentSettingsPattern::FromString(kAtlassiancom),
-            ContentSettingsPattern::FromString(kAtlassiannet)
-          },
-          {
-            ContentSettingsPattern::FromString(kAtlassiannet),
-            ContentSettingsPattern::FromString(kAtlassiancom)
-          }
-      });
-
   GURL first_party_url = site_for_cookies;
 
   if (!first_party_url.is_valid() && top_frame_origin)
       first_party_url = top_frame_origin->GetURL();
 
-  if (net::registry_controlled_domains::GetDomainAndRegistry(
-          url,
-          net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES) ==
-      net::registry_controlled_domains::GetDomainAndRegistry(
-          first_party_url,
-          net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES))
+  const std::string domain = GetRegistrableDomain(url);
+  const std::string first_party_domain = GetRegistrableDomain(first_party_url);
+  if (domain == first_party_domain)
     return true;
 
-  for (auto i = entity_list->begin();
-       i != entity_list->end();
-       ++i) {
-    if (i->first.Matches(url) && i->second.Matches(first_party_url))
+  const EntityMap& entity_map = GetEntityMap();
+  const auto domain_it = entity_map.find(domain);
+  if (domain_it == entity_map.end())
+    return false;
+  const auto first_party_it = domain_it->second.find(first_party_domain);
+  if (first_party_it == domain_it->second.end())
+    return false;
+
+  // The patterns may be narrower than the whole domain.
+  for (const auto& patterns : first_party_it->second) {
+    if (patterns.first.Matches(url) && patterns.second.Matches(first_party_url))
       return true;
   }
 
@@ -154,21 +142,20 @@ bool CookieSettingsBase::IsCookieAccessAllowed(
     const GURL& url,
     const GURL& site_for_cookies,
     const base::Optional<url::Origin>& top_frame_origin) const {
+  // Default 3rd-party blocking only turns allowed cookies into blocked ones,
+  // so for other urls the Chromium check alone gives the same answer as
+  // checking the content settings first.
+  if (!BraveIsAllowedThirdParty(url, site_for_cookies, top_frame_origin))
+    return IsChromiumCookieAccessAllowed(url, site_for_cookies,
+                                         top_frame_origin);
 
   // Get content settings only - do not consider default 3rd-party blocking.
+  // Content settings should always override any defaults.
   ContentSetting setting;
   GetCookieSettingInternal(
       url, top_frame_origin ? top_frame_origin->GetURL() : site_for_cookies,
       false, nullptr, &setting);
-
-  // Content settings should always override any defaults.
-  if (!IsAllowed(setting))
-    return false;
-
-  if (BraveIsAllowedThirdParty(url, site_for_cookies, top_frame_origin))
-    return true;
-
-  return IsChromiumCookieAccessAllowed(url, site_for_cookies, top_frame_origin);
+  return IsAllowed(setting);
 }
 
 }  // namespace content_settings
@@ -226,11 +226,17 @@ BraveSessionCache::PerturbPixelsInternal(
 
 WTF::String BraveSessionCache::GenerateRandomString(std::string seed,
                                                     wtf_size_t length) {
+  auto cache_key = std::make_pair(std::move(seed), length);
+  auto it = random_strings_.find(cache_key);
+  if (it != random_strings_.end())
+    return it->second;
+  const std::string& seed_string = cache_key.first;
+
   uint8_t key[32];
   crypto::HMAC h(crypto::HMAC::SHA256);
   CHECK(h.Init(reinterpret_cast<const unsigned char*>(&domain_key_),
                sizeof domain_key_));
-  CHECK(h.Sign(seed, key, sizeof key));
+  CHECK(h.Sign(seed_string, key, sizeof key));
   // initial PRNG seed based on session key and passed-in seed string
   uint64_t v = *reinterpret_cast<uint64_t*>(key);
   UChar* destination;
@@ -240,17 +246,24 @@ WTF::String BraveSessionCache::GenerateRandomString(std::string seed,
         kLettersForRandomStrings[v % kLettersForRandomStringsLength];
     v = lfsr_next(v);
   }
+  random_strings_.emplace(std::move(cache_key), value);
   return value;
 }
 
 WTF::String BraveSessionCache::FarbledUserAgent(WTF::String real_user_agent) {
+  // The user agent rarely changes within a context, so only re-derive the
+  // farbled one when it does.
+  if (!farbled_user_agent_.IsNull() && real_user_agent == real_user_agent_)
+    return farbled_user_agent_;
   std::mt19937_64 prng = MakePseudoRandomGenerator();
   WTF::StringBuilder result;
   result.Append(real_user_agent);
   int extra = prng() % kFarbledUserAgentMaxExtraSpaces;
   for (int i = 0; i < extra; i++)
     result.Append(" ");
-  return result.ToString();
+  real_user_agent_ = real_user_agent;
+  farbled_user_agent_ = result.ToString();
+  return farbled_user_agent_;
 }
 
 std::mt19937_64 BraveSessionCache::MakePseudoRandomGenerator() {
@@ -8,7 +8,10 @@
 
 #include "../../../../../../../third_party/blink/renderer/core/execution_context/execution_context.h"
 
+#include <map>
 #include <random>
+#include <string>
+#include <utility>
 
 #include "base/callback.h"
 
@@ -57,6 +60,12 @@ class CORE_EXPORT BraveSessionCache final
   uint64_t session_key_;
   uint8_t domain_key_[32];
 
+  // Generated strings only depend on the domain key and their seed and
+  // length, so are generated once per context.
+  std::map<std::pair<std::string, wtf_size_t>, WTF::String> random_strings_;
+  WTF::String real_user_agent_;
+  WTF::String farbled_user_agent_;
+
   scoped_refptr<blink::StaticBitmapImage> PerturbPixelsInternal(
       scoped_refptr<blink::StaticBitmapImage> image_bitmap);
 };
@@ -66,8 +66,8 @@ void FarblePlugins(DOMPluginArray* owner,
       U_FALLTHROUGH;
     }
     case BraveFarblingLevel::BALANCED: {
-      std::mt19937_64 prng = BraveSessionCache::From(*(frame->DomWindow()))
-                                 .MakePseudoRandomGenerator();
+      BraveSessionCache& cache = BraveSessionCache::From(*(frame->DomWindow()));
+      std::mt19937_64 prng = cache.MakePseudoRandomGenerator();
       // The item() method will populate plugin info if any item of
       // |dom_plugins_| is null, but when it tries, it assumes the
       // length of |dom_plugins_| == the length of the underlying
@@ -83,24 +83,19 @@ void FarblePlugins(DOMPluginArray* owner,
         if ((name == "Chrome PDF Plugin") || (name == "Chrome PDF Viewer")) {
           plugin->SetName(PluginReplacementName(&prng));
           plugin->SetFilename(
-              BraveSessionCache::From(*(frame->DomWindow()))
-                  .GenerateRandomString(plugin->Filename().Ascii(), 32));
+              cache.GenerateRandomString(plugin->Filename().Ascii(), 32));
         }
         (*dom_plugins)[index] = MakeGarbageCollected<DOMPlugin>(frame, *plugin);
       }
       // Add fake plugin #1.
       auto* fake_plugin_info_1 = MakeGarbageCollected<PluginInfo>(
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("PLUGIN_1_NAME", 8),
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("PLUGIN_1_FILENAME", 16),
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("PLUGIN_1_DESCRIPTION", 32),
+          cache.GenerateRandomString("PLUGIN_1_NAME", 8),
+          cache.GenerateRandomString("PLUGIN_1_FILENAME", 16),
+          cache.GenerateRandomString("PLUGIN_1_DESCRIPTION", 32),
           0, false);
       auto* fake_mime_info_1 = MakeGarbageCollected<MimeClassInfo>(
           "",
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("MIME_1_DESCRIPTION", 32),
+          cache.GenerateRandomString("MIME_1_DESCRIPTION", 32),
           *fake_plugin_info_1);
       fake_plugin_info_1->AddMimeType(fake_mime_info_1);
       auto* fake_dom_plugin_1 =
@@ -108,17 +103,13 @@ void FarblePlugins(DOMPluginArray* owner,
       dom_plugins->push_back(fake_dom_plugin_1);
       // Add fake plugin #2.
       auto* fake_plugin_info_2 = MakeGarbageCollected<PluginInfo>(
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("PLUGIN_2_NAME", 7),
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("PLUGIN_2_FILENAME", 15),
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("PLUGIN_2_DESCRIPTION", 31),
+          cache.GenerateRandomString("PLUGIN_2_NAME", 7),
+          cache.GenerateRandomString("PLUGIN_2_FILENAME", 15),
+          cache.GenerateRandomString("PLUGIN_2_DESCRIPTION", 31),
           0, false);
       auto* fake_mime_info_2 = MakeGarbageCollected<MimeClassInfo>(
           "",
-          BraveSessionCache::From(*(frame->DomWindow()))
-              .GenerateRandomString("MIME_2_DESCRIPTION", 32),
+          cache.GenerateRandomString("MIME_2_DESCRIPTION", 32),
           *fake_plugin_info_2);
       fake_plugin_info_2->AddMimeType(fake_mime_info_2);
       auto* fake_dom_plugin_2 =
@@ -4,29 +4,18 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "../../../../../../../third_party/blink/renderer/modules/storage/dom_window_storage.cc"
-#include "third_party/blink/public/common/dom_storage/session_storage_namespace_id.h"
+#include "brave/components/ephemeral_storage/ephemeral_storage.mojom-blink.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+#include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
 #include "third_party/blink/public/common/features.h"
-#include "third_party/blink/public/web/web_view_client.h"
-#include "third_party/blink/renderer/core/execution_context/execution_context.h"
-#include "third_party/blink/renderer/core/exported/web_view_impl.h"
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
-#include "third_party/blink/renderer/core/frame/web_local_frame_impl.h"
+#include "third_party/blink/renderer/core/frame/local_frame_client.h"
 #include "third_party/blink/renderer/modules/storage/brave_dom_window_storage.h"
 
 namespace blink {
 
 namespace {
 
-// This replicates the conversion of a string into a session storage namespace
-// id that is found in the implementation of EphemeralStorageTabHelper.
-String StringToSessionStorageId(const String& string,
-                                const std::string& suffix) {
-  std::string hash =
-      base::MD5String(std::string(string.Utf8()) + suffix) + "____";
-  DCHECK_EQ(hash.length(), kSessionStorageNamespaceIdLength);
-  return String(hash.c_str());
-}
-
 // If storage is null and there was an exception then clear the exception unless
 // it was caused by CanAccessSessionStorage for the document security origin
 // (sandbox, data urls, etc...)
@@ -49,8 +38,8 @@ void MaybeClearAccessDeniedException(StorageArea* storage,
 // as soon as a third-party frame needs ephemeral storage. They are then shared
 // by all third-party frames that are embedded in this Page.
 //
-// These namespaces are created in the browser process ahead of time. We ensure
-// that we are using the same namespace by using a common naming scheme.
+// The browser process creates these namespaces when they are first asked for
+// and tells us their ids.
 class EphemeralStorageNamespaces
     : public GarbageCollected<EphemeralStorageNamespaces>,
       public Supplement<Page> {
@@ -105,26 +94,22 @@ EphemeralStorageNamespaces* EphemeralStorageNamespaces::From(
   if (supplement)
     return supplement;
 
-  auto* web_frame = WebLocalFrameImpl::FromFrame(window->GetFrame());
-  WebViewImpl* webview = web_frame->ViewImpl();
-  if (!webview || !webview->Client())
+  LocalFrameClient* client = window->GetFrame()->Client();
+  if (!client || !client->GetRemoteNavigationAssociatedInterfaces())
+    return nullptr;
+
+  mojo::AssociatedRemote<ephemeral_storage::mojom::blink::EphemeralStorage>
+      ephemeral_storage;
+  client->GetRemoteNavigationAssociatedInterfaces()->GetInterface(
+      &ephemeral_storage);
+  String local_storage_id;
+  String session_storage_id;
+  if (!ephemeral_storage->GetNamespaceIds(&local_storage_id,
+                                          &session_storage_id) ||
+      local_storage_id.IsEmpty() || session_storage_id.IsEmpty()) {
     return nullptr;
-  String session_storage_id = StringToSessionStorageId(
-      String::FromUTF8(webview->Client()->GetSessionStorageNamespaceId()),
-      "/ephemeral-session-storage");
-
-  auto* security_origin =
-      page->MainFrame()->GetSecurityContext()->GetSecurityOrigin();
-  String domain = security_origin->RegistrableDomain();
-  // RegistrableDomain might return an empty string if this host is an IP
-  // address or a file URL.
-  if (domain.IsEmpty()) {
-    url::Origin origin = url::Origin::Create(GURL(window->Url()).GetOrigin());
-    domain = String::FromUTF8(origin.Serialize());
   }
 
-  String local_storage_id =
-      StringToSessionStorageId(domain, "/ephemeral-local-storage");
   supplement = MakeGarbageCollected<EphemeralStorageNamespaces>(
       StorageController::GetInstance(), session_storage_id, local_storage_id);
 
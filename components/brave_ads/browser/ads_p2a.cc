@@ -11,7 +11,7 @@
 
 #include "base/metrics/histogram_functions.h"
 #include "brave/components/brave_ads/common/pref_names.h"
-#include "brave/components/weekly_storage/weekly_storage.h"
+#include "brave/components/weekly_storage/weekly_storage_service.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 
@@ -99,15 +99,14 @@ void RegisterP2APrefs(
 
 void RecordInWeeklyStorageAndEmitP2AHistogramAnswer(
     PrefService* prefs,
+    WeeklyStorageService* weekly_storage,
     const std::string& name) {
   std::string pref_path(prefs::kP2AStoragePrefNamePrefix);
   pref_path.append(name);
   if (!prefs->FindPreference(pref_path)) {
     return;
   }
-  WeeklyStorage storage(prefs, pref_path.c_str());
-  storage.AddDelta(1);
-  EmitP2AHistogramAnswer(name, storage.GetWeeklySum());
+  EmitP2AHistogramAnswer(name, weekly_storage->AddDelta(pref_path, 1));
 }
 
 void EmitP2AHistogramAnswer(
@@ -13,6 +13,7 @@
 
 class PrefService;
 class PrefRegistrySimple;
+class WeeklyStorageService;
 
 namespace brave_ads {
 
@@ -20,6 +21,7 @@ void RegisterP2APrefs(PrefRegistrySimple* prefs);
 
 void RecordInWeeklyStorageAndEmitP2AHistogramAnswer(
     PrefService* prefs,
+    WeeklyStorageService* weekly_storage,
     const std::string& name);
 
 void EmitP2AHistogramAnswer(
@@ -54,6 +54,7 @@
 #include "brave/components/brave_rewards/common/pref_names.h"
 #include "brave/components/services/bat_ads/public/cpp/ads_client_mojo_bridge.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+#include "brave/components/weekly_storage/weekly_storage_service_factory.h"
 #include "brave/components/brave_ads/browser/notification_helper.h"
 #include "chrome/browser/browser_process.h"
 #include "brave/browser/brave_browser_process_impl.h"
@@ -1864,9 +1865,11 @@ void AdsServiceImpl::RecordP2AEvent(
         break;
       }
 
+      WeeklyStorageService* weekly_storage =
+          WeeklyStorageServiceFactory::GetForBrowserContext(profile_);
       for (auto& item : *list) {
         RecordInWeeklyStorageAndEmitP2AHistogramAnswer(
-            profile_->GetPrefs(), item.GetString());
+            profile_->GetPrefs(), weekly_storage, item.GetString());
       }
       break;
     }
@@ -8,8 +8,12 @@
 #include <memory>
 #include <utility>
 
+#include "base/feature_list.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
+#include "brave/components/brave_ads/common/features.h"
 #include "chrome/browser/profiles/profile.h"
 #include "components/dom_distiller/content/browser/distiller_page_web_contents.h"
 #include "components/dom_distiller/content/browser/distiller_javascript_utils.h"
@@ -27,6 +31,58 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Extracts at most |maxLength| characters of page text in the renderer so that
+// large pages do not send multi-megabyte strings to the browser process. The
+// title and meta descriptions are sampled first as they are the most
+// representative of the page, followed by the rendered body text. innerText is
+// used for the body so that text hidden by CSS is skipped and inline elements
+// are not split into separate words
+constexpr char kPageTextExtractionScript[] = R"(
+  (function(maxLength) {
+    let text = '';
+
+    const append = (value) => {
+      if (!value || text.length >= maxLength) {
+        return;
+      }
+
+      value = value.replace(/\s+/g, ' ').trim();
+      if (!value) {
+        return;
+      }
+
+      text += value.substring(0, maxLength - text.length) + ' ';
+    };
+
+    append(document.title);
+
+    const metaSelectors = [
+      'meta[name="description"]',
+      'meta[name="keywords"]',
+      'meta[property="og:title"]',
+      'meta[property="og:description"]'
+    ];
+    for (const selector of metaSelectors) {
+      const element = document.querySelector(selector);
+      if (element) {
+        append(element.getAttribute('content'));
+      }
+    }
+
+    if (document.body) {
+      append(document.body.innerText);
+    }
+
+    return text;
+  })($1)
+)";
+
+constexpr char kPageTextScript[] = "document.body.innerText";
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(sessions::SessionTabHelper::IdForTab(web_contents)),
@@ -77,10 +133,16 @@ void AdsTabHelper::RunIsolatedJavaScript(
     content::RenderFrameHost* render_frame_host) {
   DCHECK(render_frame_host);
 
-  dom_distiller::RunIsolatedJavaScript(render_frame_host,
-      "document.body.innerText",
-          base::BindOnce(&AdsTabHelper::OnJavaScriptResult,
-              weak_factory_.GetWeakPtr()));
+  std::string script = kPageTextScript;
+  if (base::FeatureList::IsEnabled(features::kPageTextExtraction)) {
+    script = base::ReplaceStringPlaceholders(kPageTextExtractionScript,
+        {base::NumberToString(features::GetPageTextExtractionMaxLength())},
+        nullptr);
+  }
+
+  dom_distiller::RunIsolatedJavaScript(render_frame_host, script,
+      base::BindOnce(&AdsTabHelper::OnJavaScriptResult,
+          weak_factory_.GetWeakPtr()));
 }
 
 void AdsTabHelper::OnJavaScriptResult(
@@ -0,0 +1,38 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/common/features.h"
+
+#include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
+
+namespace brave_ads {
+namespace features {
+
+namespace {
+
+const int kDefaultPageTextExtractionMaxLength = 64 * 1024;
+
+}  // namespace
+
+// Controls whether page text is extracted from the renderer with a character
+// budget for page classification. When disabled the full body text is
+// extracted
+const base::Feature kPageTextExtraction{
+    "PageTextExtraction",
+    base::FEATURE_ENABLED_BY_DEFAULT};
+
+int GetPageTextExtractionMaxLength() {
+  const int max_length = base::GetFieldTrialParamByFeatureAsInt(
+      kPageTextExtraction, "max_length", kDefaultPageTextExtractionMaxLength);
+  if (max_length <= 0) {
+    return kDefaultPageTextExtractionMaxLength;
+  }
+
+  return max_length;
+}
+
+}  // namespace features
+}  // namespace brave_ads
@@ -0,0 +1,25 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_COMMON_FEATURES_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_COMMON_FEATURES_H_
+
+namespace base {
+struct Feature;
+}  // namespace base
+
+namespace brave_ads {
+namespace features {
+
+extern const base::Feature kPageTextExtraction;
+
+// Returns the maximum number of characters of page text which are extracted
+// from the renderer for page classification
+int GetPageTextExtractionMaxLength();
+
+}  // namespace features
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_COMMON_FEATURES_H_
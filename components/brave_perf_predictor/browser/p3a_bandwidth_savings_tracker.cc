@@ -5,16 +5,10 @@
 
 #include "brave/components/brave_perf_predictor/browser/p3a_bandwidth_savings_tracker.h"
 
-#include <memory>
-#include <utility>
-
 #include "base/metrics/histogram_macros.h"
-#include "base/time/clock.h"
-#include "base/time/default_clock.h"
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
-#include "brave/components/weekly_storage/weekly_storage.h"
+#include "brave/components/weekly_storage/weekly_storage_service.h"
 #include "components/prefs/pref_registry_simple.h"
-#include "components/prefs/pref_service.h"
 
 namespace brave_perf_predictor {
 
@@ -38,22 +32,14 @@ constexpr char kSavingsDailyUMAHistogramName[] =
 
 }  // namespace
 
-P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(PrefService* user_prefs)
-    : P3ABandwidthSavingsTracker(user_prefs,
-                                 std::make_unique<base::DefaultClock>()) {}
-
 P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(
-    PrefService* user_prefs,
-    std::unique_ptr<base::Clock> clock)
-    : user_prefs_(user_prefs), clock_(std::move(clock)) {}
+    WeeklyStorageService* weekly_storage)
+    : weekly_storage_(weekly_storage) {}
 
 void P3ABandwidthSavingsTracker::RecordSavings(uint64_t savings) {
-  if (savings > 0 && user_prefs_) {
-    // TODO(AndriusA): optimise if needed, loading permanent state on every
-    // record could be costly
-    WeeklyStorage weekly(user_prefs_, prefs::kBandwidthSavedDailyBytes);
-    weekly.AddDelta(savings);
-    StoreSavingsHistogram(weekly.GetWeeklySum());
+  if (savings > 0 && weekly_storage_) {
+    StoreSavingsHistogram(
+        weekly_storage_->AddDelta(prefs::kBandwidthSavedDailyBytes, savings));
   }
 }
 
@@ -10,7 +10,9 @@
 
 #include "base/test/metrics/histogram_tester.h"
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
+#include "brave/components/weekly_storage/weekly_storage_service.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -23,14 +25,18 @@ class P3ABandwidthSavingsTrackerTest : public ::testing::Test {
  public:
   P3ABandwidthSavingsTrackerTest() : clock_(new base::SimpleTestClock) {
     P3ABandwidthSavingsTracker::RegisterPrefs(pref_service_.registry());
-    tracker_ = std::make_unique<P3ABandwidthSavingsTracker>(
+    weekly_storage_ = std::make_unique<WeeklyStorageService>(
         &pref_service_, std::unique_ptr<base::Clock>(clock_));
+    tracker_ =
+        std::make_unique<P3ABandwidthSavingsTracker>(weekly_storage_.get());
     clock_->SetNow(base::Time::Now());
   }
 
  protected:
+  base::test::TaskEnvironment task_environment_;
   base::SimpleTestClock* clock_;
   TestingPrefServiceSimple pref_service_;
+  std::unique_ptr<WeeklyStorageService> weekly_storage_;
   std::unique_ptr<P3ABandwidthSavingsTracker> tracker_;
 };
 
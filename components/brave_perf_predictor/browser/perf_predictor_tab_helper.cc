@@ -7,6 +7,7 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry_factory.h"
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
+#include "brave/components/weekly_storage/weekly_storage_service_factory.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "components/user_prefs/user_prefs.h"
@@ -51,7 +52,8 @@ PerfPredictorTabHelper::PerfPredictorTabHelper(
     return;
 
   bandwidth_tracker_ = std::make_unique<P3ABandwidthSavingsTracker>(
-      user_prefs::UserPrefs::Get(web_contents->GetBrowserContext()));
+      WeeklyStorageServiceFactory::GetForBrowserContext(
+          web_contents->GetBrowserContext()));
 }
 
 PerfPredictorTabHelper::~PerfPredictorTabHelper() = default;
@@ -5,10 +5,12 @@
 
 #include "brave/components/brave_prochlo/brave_prochlo_message.h"
 
+#include <memory>
 #include <vector>
 
 #include "base/containers/flat_set.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/stl_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/trace_event/trace_event.h"
@@ -35,53 +37,56 @@ MFkwEwYHKoZIzj0CAQYIKoZIzj0DAQcDQgAEQCeVJbcADloHb8bwftIi1UO0smiz
 8ObdAFQ8j3U9cMehGqI3zXgS8APvBW/9XxMkb4XWQe+t9h6qHq82P6zcBg==
 -----END PUBLIC KEY-----)";
 
-bool MakeProchlomation(uint64_t metric,
-                       const uint8_t* data,
-                       const uint8_t* crowd_id,
-                       ShufflerItem* shuffler_item) {
-  DCHECK(data);
-  DCHECK(crowd_id);
-  DCHECK(shuffler_item);
-  // TODO(iefremov): - create patch for adding `brave_p3a`
-  // to src/base/trace_event/builtin_categories.h
-  // TRACE_EVENT0("brave_p3a", "MakeProchlomation");
-
-  BraveProchloCrypto crypto;
+std::unique_ptr<BraveProchloCrypto> CreateProchloCrypto() {
+  auto crypto = std::make_unique<BraveProchloCrypto>();
 
   const std::vector<char> shuffler_key(
       &kShufflerKey[0], &kShufflerKey[0] + base::size(kShufflerKey));
-  if (!crypto.load_shuffler_key_from_bytes(shuffler_key)) {
-    return false;
+  if (!crypto->load_shuffler_key_from_bytes(shuffler_key)) {
+    return nullptr;
   }
 
   const std::vector<char> analyzer_key(
       &kAnalyzerKey[0], &kAnalyzerKey[0] + base::size(kAnalyzerKey));
-  if (!crypto.load_analyzer_key_from_bytes(analyzer_key)) {
-    return false;
+  if (!crypto->load_analyzer_key_from_bytes(analyzer_key)) {
+    return nullptr;
   }
 
-  // We have to create a Prochlomation and a PlainShufflerItem to encrypt them
-  // both into an AnalyzerItea and a ShufflerItem, respectively. We'll stage
-  // those here. We can probably do this more efficiently to avoid copies.
-  Prochlomation prochlomation;
-  PlainShufflerItem plain_shuffler_item;
+  return crypto;
+}
+
+// Parsing the PEM keys costs more than encrypting a message, so the parsed
+// keys are kept for the lifetime of the process. Only the ephemeral key pairs
+// are generated per message.
+BraveProchloCrypto* GetProchloCrypto() {
+  static base::NoDestructor<std::unique_ptr<BraveProchloCrypto>> crypto(
+      CreateProchloCrypto());
+  return crypto->get();
+}
 
-  // First the prochlomation
-  prochlomation.metric = metric;
-  memcpy(prochlomation.data, data, kProchlomationDataLength);
+bool MakeProchlomation(BraveProchloCrypto* prochlo_crypto,
+                       const Prochlomation& prochlomation,
+                       const uint8_t* crowd_id,
+                       ShufflerItem* shuffler_item) {
+  DCHECK(prochlo_crypto);
+  DCHECK(crowd_id);
+  DCHECK(shuffler_item);
+  // TODO(iefremov): - create patch for adding `brave_p3a`
+  // to src/base/trace_event/builtin_categories.h
+  // TRACE_EVENT0("brave_p3a", "MakeProchlomation");
 
-  // Then the AnalyzerItem of the PlainShufflerItem
-  if (!crypto.EncryptForAnalyzer(prochlomation,
-                                 &plain_shuffler_item.analyzer_item)) {
+  // The analyzer item is encrypted straight into the PlainShufflerItem, which
+  // is then encrypted into the ShufflerItem.
+  PlainShufflerItem plain_shuffler_item;
+  if (!prochlo_crypto->EncryptForAnalyzer(prochlomation,
+                                         &plain_shuffler_item.analyzer_item)) {
     NOTREACHED();
     return false;
   }
 
-  // Now prepare the PlainShufflerItem
   memcpy(plain_shuffler_item.crowd_id, crowd_id, kCrowdIdLength);
 
-  // And create the ShufflerItem
-  if (!crypto.EncryptForShuffler(plain_shuffler_item, shuffler_item)) {
+  if (!prochlo_crypto->EncryptForShuffler(plain_shuffler_item, shuffler_item)) {
     NOTREACHED();
     return false;
   }
@@ -101,31 +106,8 @@ void InitProchloMessage(uint64_t metric_hash,
   value->set_client_public_key(item.client_public_key, kPublicKeyLength);
 }
 
-}  // namespace
-
-MessageMetainfo::MessageMetainfo() = default;
-MessageMetainfo::~MessageMetainfo() = default;
-
-void GenerateProchloMessage(uint64_t metric_hash,
-                            uint64_t metric_value,
-                            const MessageMetainfo& meta,
-                            brave_pyxis::PyxisMessage* pyxis_message) {
-  // TODO(iefremov): - create patch for adding `brave_p3a`
-  // to src/base/trace_event/builtin_categories.h
-  // TRACE_EVENT0("brave_p3a", "GenerateProchloMessage");
-  ShufflerItem item;
-  uint8_t data[kProchlomationDataLength] = {0};
-  uint8_t crowd_id[kCrowdIdLength] = {0};
-
-  // First byte contains the 4 booleans.
-  const char daily = 1;
-  const char weekly = 0;
-  const char monthly = 2;
-  const char first = 0;
-  data[0] = daily | weekly | monthly | first;
-  uint8_t* ptr = data;
-  ptr++;
-
+// Builds the part of the message data shared by every metric of a report.
+std::string MakeMetastring(const MessageMetainfo& meta) {
   // Find out years of install and survey.
   base::Time::Exploded exploded;
   meta.date_of_survey.LocalExplode(&exploded);
@@ -135,10 +117,27 @@ void GenerateProchloMessage(uint64_t metric_hash,
   DCHECK_GE(exploded.year, 999);
   const std::string yoi = base::NumberToString(exploded.year).substr(2, 4);
 
-  const std::string metastring =
-      "," + meta.country_code + "," + meta.platform + "," + meta.version + "," +
-      meta.channel + "," + yoi + base::NumberToString(meta.woi) + "," + yos +
-      base::NumberToString(meta.wos) + "," + meta.refcode + ",";
+  return "," + meta.country_code + "," + meta.platform + "," + meta.version +
+         "," + meta.channel + "," + yoi + base::NumberToString(meta.woi) +
+         "," + yos + base::NumberToString(meta.wos) + "," + meta.refcode + ",";
+}
+
+void AddProchloValue(BraveProchloCrypto* prochlo_crypto,
+                     uint64_t metric_hash,
+                     uint64_t metric_value,
+                     const std::string& metastring,
+                     brave_pyxis::PyxisMessage* pyxis_message) {
+  Prochlomation prochlomation = {};
+  prochlomation.metric = metric_hash;
+
+  // First byte contains the 4 booleans.
+  const char daily = 1;
+  const char weekly = 0;
+  const char monthly = 2;
+  const char first = 0;
+  prochlomation.data[0] = daily | weekly | monthly | first;
+  uint8_t* ptr = prochlomation.data;
+  ptr++;
 
   const std::string metric_value_str = base::NumberToString(metric_value);
 
@@ -151,14 +150,52 @@ void GenerateProchloMessage(uint64_t metric_hash,
   memcpy(ptr, metric_value_str.data(), metric_value_str.size());
 
   // TODO(iefremov): Salt?
+  uint8_t crowd_id[kCrowdIdLength] = {0};
   crypto::SHA256HashString(
       base::NumberToString(metric_hash) + base::NumberToString(metric_value),
       crowd_id, kCrowdIdLength);
-  MakeProchlomation(metric_hash, data, crowd_id, &item);
+
+  ShufflerItem item;
+  MakeProchlomation(prochlo_crypto, prochlomation, crowd_id, &item);
 
   InitProchloMessage(metric_hash, item, pyxis_message);
 }
 
+}  // namespace
+
+MessageMetainfo::MessageMetainfo() = default;
+MessageMetainfo::~MessageMetainfo() = default;
+
+void GenerateProchloMessage(uint64_t metric_hash,
+                            uint64_t metric_value,
+                            const MessageMetainfo& meta,
+                            brave_pyxis::PyxisMessage* pyxis_message) {
+  GenerateProchloMessages({{metric_hash, metric_value}}, meta, pyxis_message);
+}
+
+void GenerateProchloMessages(
+    const std::vector<std::pair<uint64_t, uint64_t>>& metrics,
+    const MessageMetainfo& meta,
+    brave_pyxis::PyxisMessage* pyxis_message) {
+  // TODO(iefremov): - create patch for adding `brave_p3a`
+  // to src/base/trace_event/builtin_categories.h
+  // TRACE_EVENT0("brave_p3a", "GenerateProchloMessages");
+  DCHECK(pyxis_message);
+  BraveProchloCrypto* prochlo_crypto = GetProchloCrypto();
+  if (!prochlo_crypto) {
+    NOTREACHED();
+    return;
+  }
+
+  const std::string metastring = MakeMetastring(meta);
+  pyxis_message->mutable_pyxis_values()->Reserve(
+      pyxis_message->pyxis_values_size() + static_cast<int>(metrics.size()));
+  for (const auto& metric : metrics) {
+    AddProchloValue(prochlo_crypto, metric.first, metric.second, metastring,
+                    pyxis_message);
+  }
+}
+
 void GenerateP3AMessage(uint64_t metric_hash,
                         uint64_t metric_value,
                         const MessageMetainfo& meta,
@@ -8,6 +8,9 @@
 
 #include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
+
 #include "base/time/time.h"
 
 namespace brave_pyxis {
@@ -38,6 +41,14 @@ void GenerateProchloMessage(uint64_t metric_hash,
                             const MessageMetainfo& meta,
                             brave_pyxis::PyxisMessage* prochlo_message);
 
+// Appends one encrypted value per (metric hash, metric value) pair of
+// |metrics| to |prochlo_message|. Prefer this over repeated calls to
+// GenerateProchloMessage() when sending several metrics at once.
+void GenerateProchloMessages(
+    const std::vector<std::pair<uint64_t, uint64_t>>& metrics,
+    const MessageMetainfo& meta,
+    brave_pyxis::PyxisMessage* prochlo_message);
+
 void GenerateP3AMessage(uint64_t metric_hash,
                         uint64_t metric_value,
                         const MessageMetainfo& meta,
@@ -0,0 +1,77 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_prochlo/brave_prochlo_message.h"
+
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "brave/components/brave_prochlo/prochlo_data.h"
+#include "brave/components/brave_prochlo/prochlo_message.pb.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveProchloMessageTest.*
+
+namespace prochlo {
+
+namespace {
+
+const size_t kMetricCount = 100;
+
+MessageMetainfo GetMetainfo() {
+  MessageMetainfo meta;
+  meta.platform = "winx64-bc";
+  meta.version = "1.18.0";
+  meta.channel = "release";
+  meta.date_of_install = base::Time::FromDoubleT(1600000000);
+  meta.date_of_survey = base::Time::FromDoubleT(1603000000);
+  meta.woi = 37;
+  meta.wos = 42;
+  meta.country_code = "US";
+  meta.refcode = "none";
+  return meta;
+}
+
+}  // namespace
+
+TEST(BraveProchloMessageTest, GenerateProchloMessages) {
+  std::vector<std::pair<uint64_t, uint64_t>> metrics;
+  for (size_t i = 0; i < kMetricCount; i++) {
+    metrics.emplace_back(1000 + i, i % 8);
+  }
+
+  brave_pyxis::PyxisMessage message;
+  GenerateProchloMessages(metrics, GetMetainfo(), &message);
+
+  ASSERT_EQ(static_cast<int>(kMetricCount), message.pyxis_values_size());
+
+  std::set<std::string> client_public_keys;
+  for (size_t i = 0; i < kMetricCount; i++) {
+    const brave_pyxis::PyxisValue& value = message.pyxis_values(i);
+    EXPECT_EQ(metrics[i].first, value.metric_id());
+    EXPECT_EQ(kPlainShufflerItemLength, value.ciphertext().size());
+    EXPECT_EQ(kTagLength, value.tag().size());
+    EXPECT_EQ(kNonceLength, value.nonce().size());
+    client_public_keys.insert(value.client_public_key());
+  }
+
+  // Every value is encrypted with its own ephemeral key pair even though the
+  // shuffler and analyzer keys are shared.
+  EXPECT_EQ(kMetricCount, client_public_keys.size());
+}
+
+TEST(BraveProchloMessageTest, GenerateProchloMessageAppends) {
+  brave_pyxis::PyxisMessage message;
+  GenerateProchloMessage(1, 2, GetMetainfo(), &message);
+  GenerateProchloMessage(3, 4, GetMetainfo(), &message);
+
+  ASSERT_EQ(2, message.pyxis_values_size());
+  EXPECT_EQ(1u, message.pyxis_values(0).metric_id());
+  EXPECT_EQ(3u, message.pyxis_values(1).metric_id());
+}
+
+}  // namespace prochlo
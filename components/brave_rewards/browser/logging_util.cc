@@ -104,6 +104,23 @@ bool InitializeLog(
   return true;
 }
 
+bool OpenLogForAppend(
+    base::File* file,
+    const base::FilePath& path) {
+  DCHECK(file);
+
+  if (!base::PathExists(path)) {
+    file->Close();
+    return CreateLog(file, path);
+  }
+
+  if (file->IsValid()) {
+    return true;
+  }
+
+  return OpenLog(file, path);
+}
+
 bool WriteToLog(
     base::File* file,
     const std::string& log_entry) {
@@ -120,6 +137,37 @@ bool WriteToLog(
   return true;
 }
 
+bool RotateLog(
+    base::File* file,
+    const base::FilePath& path,
+    const base::FilePath& rotated_path) {
+  DCHECK(file);
+
+  // Close the log before renaming it (required on Windows)
+  file->Close();
+
+  return base::ReplaceFile(path, rotated_path, nullptr);
+}
+
+bool ReadLog(
+    const base::FilePath& path,
+    const int num_lines,
+    std::string* value) {
+  DCHECK(value);
+
+  if (!base::PathExists(path)) {
+    *value = "";
+    return true;
+  }
+
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid()) {
+    return false;
+  }
+
+  return TailFileAsString(&file, num_lines, value);
+}
+
 std::string FriendlyFormatLogEntry(
     const base::Time& time,
     const std::string& file,
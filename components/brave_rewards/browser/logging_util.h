@@ -17,6 +17,13 @@ bool InitializeLog(
     base::File* file,
     const base::FilePath& path);
 
+// Opens the log at |path| for appending, creating it if missing. Unlike
+// |InitializeLog| no divider is written to an existing log, so that entries
+// written in batches during a session are not split up
+bool OpenLogForAppend(
+    base::File* file,
+    const base::FilePath& path);
+
 std::string FriendlyFormatLogEntry(
     const base::Time& time,
     const std::string& file,
@@ -28,6 +35,20 @@ bool WriteToLog(
     base::File* file,
     const std::string& log_entry);
 
+// Closes |file| and renames the log at |path| to |rotated_path|, replacing any
+// previously rotated log. The next call to |InitializeLog| starts a new log
+bool RotateLog(
+    base::File* file,
+    const base::FilePath& path,
+    const base::FilePath& rotated_path);
+
+// Reads the last |num_lines| lines, or all lines if |num_lines| is -1, of the
+// log at |path|. A missing log is read as empty
+bool ReadLog(
+    const base::FilePath& path,
+    const int num_lines,
+    std::string* value);
+
 }  // namespace brave_rewards
 
 #endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LOGGING_UTIL_H_
@@ -101,8 +101,9 @@ static const unsigned int kRetriesCountOnNetworkChange = 1;
 namespace {
 
 const int kDiagnosticLogMaxVerboseLevel = 6;
-const int kTailDiagnosticLogToNumLines = 20000;
 const int kDiagnosticLogMaxFileSize = 10 * (1024 * 1024);
+const size_t kDiagnosticLogMaxPendingEntries = 1000;
+const int kDiagnosticLogFlushDelayInSeconds = 5;
 const char pref_prefix[] = "brave.rewards";
 
 std::string URLMethodToRequestType(ledger::type::UrlMethod method) {
@@ -279,12 +280,14 @@ bool IsMediaLink(const GURL& url,
 // read comment about file pathes at src\base\files\file_path.h
 #if defined(OS_WIN)
 const base::FilePath::StringType kDiagnosticLogPath(L"Rewards.log");
+const base::FilePath::StringType kRotatedDiagnosticLogPath(L"Rewards.log.1");
 const base::FilePath::StringType kLedger_state(L"ledger_state");
 const base::FilePath::StringType kPublisher_state(L"publisher_state");
 const base::FilePath::StringType kPublisher_info_db(L"publisher_info_db");
 const base::FilePath::StringType kPublishers_list(L"publishers_list");
 #else
 const base::FilePath::StringType kDiagnosticLogPath("Rewards.log");
+const base::FilePath::StringType kRotatedDiagnosticLogPath("Rewards.log.1");
 const base::FilePath::StringType kLedger_state("ledger_state");
 const base::FilePath::StringType kPublisher_state("publisher_state");
 const base::FilePath::StringType kPublisher_info_db("publisher_info_db");
@@ -308,6 +311,8 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
            base::TaskPriority::USER_VISIBLE,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
       diagnostic_log_path_(profile_->GetPath().Append(kDiagnosticLogPath)),
+      rotated_diagnostic_log_path_(
+          profile_->GetPath().Append(kRotatedDiagnosticLogPath)),
       ledger_state_path_(profile_->GetPath().Append(kLedger_state)),
       publisher_state_path_(profile_->GetPath().Append(kPublisher_state)),
       publisher_info_db_path_(profile->GetPath().Append(kPublisher_info_db)),
@@ -786,6 +791,8 @@ std::string RewardsServiceImpl::URIEncode(const std::string& value) {
 }
 
 void RewardsServiceImpl::Shutdown() {
+  FlushDiagnosticLog();
+
   RemoveObserver(notification_service_.get());
 
   if (extension_observer_) {
@@ -1378,14 +1385,12 @@ void RewardsServiceImpl::OnStopLedgerForCompleteReset(
 }
 
 bool RewardsServiceImpl::ResetOnFilesTaskRunner() {
-  // Close any open files before deleting them (required on Windows)
-  diagnostic_log_.Close();
-
   const std::vector<base::FilePath> paths = {
     ledger_state_path_,
     publisher_state_path_,
     publisher_info_db_path_,
     diagnostic_log_path_,
+    rotated_diagnostic_log_path_,
     publisher_list_path_,
   };
 
@@ -2217,32 +2222,6 @@ void RewardsServiceImpl::ShowNotificationTipsPaid(bool ac_enabled) {
       "rewards_notification_tips_processed");
 }
 
-bool RewardsServiceImpl::MaybeTailDiagnosticLog(
-    const int num_lines) {
-  if (!diagnostic_log_.IsValid()) {
-    return false;
-  }
-
-  static bool first_run = true;
-
-  const int64_t length = diagnostic_log_.GetLength();
-  if (length == -1) {
-    return false;
-  }
-
-  if (!first_run && length <= kDiagnosticLogMaxFileSize) {
-    return true;
-  }
-
-  first_run = false;
-
-  if (!TailFile(&diagnostic_log_, num_lines)) {
-    return false;
-  }
-
-  return true;
-}
-
 void RewardsServiceImpl::DiagnosticLog(
     const std::string& file,
     const int line,
@@ -2260,47 +2239,104 @@ void RewardsServiceImpl::DiagnosticLog(
     return;
   }
 
+  DiagnosticLogEntry entry;
+  entry.time = base::Time::Now();
+  entry.file = file;
+  entry.line = line;
+  entry.verbose_level = verbose_level;
+  entry.message = message;
+  pending_diagnostic_log_entries_.push_back(std::move(entry));
+
+  if (pending_diagnostic_log_entries_.size() >=
+      kDiagnosticLogMaxPendingEntries) {
+    FlushDiagnosticLog();
+    return;
+  }
+
+  if (diagnostic_log_flush_timer_.IsRunning()) {
+    return;
+  }
+
+  diagnostic_log_flush_timer_.Start(FROM_HERE,
+      base::TimeDelta::FromSeconds(kDiagnosticLogFlushDelayInSeconds),
+      base::BindOnce(&RewardsServiceImpl::FlushDiagnosticLog,
+          base::Unretained(this)));
+}
+
+void RewardsServiceImpl::FlushDiagnosticLog() {
+  diagnostic_log_flush_timer_.Stop();
+
+  if (pending_diagnostic_log_entries_.empty()) {
+    return;
+  }
+
+  std::vector<DiagnosticLogEntry> entries;
+  entries.swap(pending_diagnostic_log_entries_);
+
+  // Only the first batch of a session is separated from the previous session
+  // by a divider
+  const bool start_session = !diagnostic_log_session_started_;
+  diagnostic_log_session_started_ = true;
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner,
-          base::Unretained(this),
           diagnostic_log_path_,
-          kTailDiagnosticLogToNumLines,
-          file,
-          line,
-          verbose_level,
-          message),
+          rotated_diagnostic_log_path_,
+          start_session,
+          std::move(entries)),
       base::BindOnce(&RewardsServiceImpl::OnWriteToLogOnFileTaskRunner,
           AsWeakPtr()));
 }
 
+void RewardsServiceImpl::DiscardPendingDiagnosticLog() {
+  diagnostic_log_flush_timer_.Stop();
+  pending_diagnostic_log_entries_.clear();
+}
+
+// static
 bool RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner(
     const base::FilePath& log_path,
-    const int num_lines,
-    const std::string& file,
-    const int line,
-    const int verbose_level,
-    const std::string& message) {
-  if (!InitializeLog(&diagnostic_log_, log_path)) {
+    const base::FilePath& rotated_log_path,
+    const bool start_session,
+    const std::vector<DiagnosticLogEntry>& entries) {
+  // The log is opened for each batch so that no file state is owned by the
+  // service, as the final batch is written after the service is destroyed
+  base::File log;
+  const bool is_open = start_session ? InitializeLog(&log, log_path)
+                                     : OpenLogForAppend(&log, log_path);
+  if (!is_open) {
     VLOG(0) << "Failed to initialize diagnostic log: "
-        << GetLastFileError(&diagnostic_log_);
+        << GetLastFileError(&log);
 
     return false;
   }
 
-  const base::Time time = base::Time::Now();
-
-  const std::string log_entry =
-      FriendlyFormatLogEntry(time, file, line, verbose_level, message);
+  std::string log_entries;
+  for (const auto& entry : entries) {
+    log_entries += FriendlyFormatLogEntry(entry.time, entry.file, entry.line,
+        entry.verbose_level, entry.message);
+  }
 
-  if (!WriteToLog(&diagnostic_log_, log_entry)) {
+  if (!WriteToLog(&log, log_entries)) {
     VLOG(0) << "Failed to write to diagnostic log: "
-        << GetLastFileError(&diagnostic_log_);
+        << GetLastFileError(&log);
 
     return false;
   }
 
-  if (!MaybeTailDiagnosticLog(num_lines)) {
-    VLOG(0) << "Failed to vacuum diagnostic log";
+  const int64_t length = log.GetLength();
+  if (length == -1) {
+    VLOG(0) << "Failed to get diagnostic log length: "
+        << GetLastFileError(&log);
+
+    return false;
+  }
+
+  // The current and rotated segments together are capped at
+  // |kDiagnosticLogMaxFileSize|
+  if (length > kDiagnosticLogMaxFileSize / 2 &&
+      !RotateLog(&log, log_path, rotated_log_path)) {
+    VLOG(0) << "Failed to rotate diagnostic log";
 
     return false;
   }
@@ -2316,10 +2352,15 @@ void RewardsServiceImpl::OnWriteToLogOnFileTaskRunner(
 void RewardsServiceImpl::LoadDiagnosticLog(
       const int num_lines,
       LoadDiagnosticLogCallback callback) {
+  // Pending entries are written before the log is loaded as both tasks run on
+  // the same sequence
+  FlushDiagnosticLog();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::LoadDiagnosticLogOnFileTaskRunner,
           base::Unretained(this),
           diagnostic_log_path_,
+          rotated_diagnostic_log_path_,
           num_lines),
       base::BindOnce(&RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner,
           AsWeakPtr(),
@@ -2328,18 +2369,27 @@ void RewardsServiceImpl::LoadDiagnosticLog(
 
 std::string RewardsServiceImpl::LoadDiagnosticLogOnFileTaskRunner(
     const base::FilePath& path,
+    const base::FilePath& rotated_path,
     const int num_lines) {
-  if (!base::PathExists(path)) {
-    return "";
+  std::string value;
+  if (!ReadLog(path, num_lines, &value)) {
+    return base::StringPrintf("ERROR: Failed to read %s",
+        path.BaseName().MaybeAsASCII().c_str());
   }
 
-  std::string value;
-  if (!TailFileAsString(&diagnostic_log_, num_lines, &value)) {
-    return base::StringPrintf("ERROR: %s",
-        GetLastFileError(&diagnostic_log_).c_str());
+  const int line_count = std::count(value.begin(), value.end(), '\n');
+  if (num_lines != -1 && line_count >= num_lines) {
+    return value;
   }
 
-  return value;
+  std::string rotated_value;
+  const int rotated_num_lines =
+      num_lines == -1 ? -1 : num_lines - line_count;
+  if (!ReadLog(rotated_path, rotated_num_lines, &rotated_value)) {
+    return value;
+  }
+
+  return rotated_value + value;
 }
 
 void RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner(
@@ -2350,24 +2400,32 @@ void RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner(
 
 void RewardsServiceImpl::ClearDiagnosticLog(
     ClearDiagnosticLogCallback callback) {
+  DiscardPendingDiagnosticLog();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner,
           base::Unretained(this),
-          diagnostic_log_path_),
+          diagnostic_log_path_,
+          rotated_diagnostic_log_path_),
       base::BindOnce(&RewardsServiceImpl::OnClearDiagnosticLogOnFileTaskRunner,
           AsWeakPtr(),
           std::move(callback)));
 }
 
 bool RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner(
-    const base::FilePath& path) {
-  if (!base::PathExists(path)) {
-    return true;
+    const base::FilePath& path,
+    const base::FilePath& rotated_path) {
+  bool success = true;
+
+  if (base::PathExists(path) && !base::DeleteFile(path)) {
+    success = false;
   }
 
-  diagnostic_log_.Close();
+  if (base::PathExists(rotated_path) && !base::DeleteFile(rotated_path)) {
+    success = false;
+  }
 
-  return base::DeleteFile(path);
+  return success;
 }
 
 void RewardsServiceImpl::OnClearDiagnosticLogOnFileTaskRunner(
@@ -3305,6 +3363,7 @@ void RewardsServiceImpl::ClearAllNotifications() {
 
 void RewardsServiceImpl::CompleteReset(SuccessCallback callback) {
   resetting_rewards_ = true;
+  DiscardPendingDiagnosticLog();
 
   auto* ads_service = brave_ads::AdsServiceFactory::GetForProfile(profile_);
   if (ads_service) {
@@ -3351,7 +3410,7 @@ void RewardsServiceImpl::WalletDisconnected(const std::string& wallet_type) {
 }
 
 void RewardsServiceImpl::DeleteLog(ledger::ResultCallback callback) {
-  diagnostic_log_.Close();
+  DiscardPendingDiagnosticLog();
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
@@ -3365,7 +3424,8 @@ void RewardsServiceImpl::DeleteLog(ledger::ResultCallback callback) {
 }
 
 bool RewardsServiceImpl::DeleteLogTaskRunner() {
-  return base::DeleteFile(diagnostic_log_path_);
+  const bool success = base::DeleteFile(diagnostic_log_path_);
+  return base::DeleteFile(rotated_diagnostic_log_path_) && success;
 }
 
 void RewardsServiceImpl::OnDeleteLog(
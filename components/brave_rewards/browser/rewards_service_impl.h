@@ -20,6 +20,8 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/one_shot_event.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "bat/ledger/ledger.h"
 #include "bat/ledger/ledger_client.h"
@@ -40,8 +42,6 @@
 #endif
 
 namespace base {
-class OneShotTimer;
-class RepeatingTimer;
 class SequencedTaskRunner;
 }  // namespace base
 
@@ -351,6 +351,15 @@ class RewardsServiceImpl : public RewardsService,
 
  private:
   friend class ::RewardsFlagBrowserTest;
+  friend class RewardsServiceTest;
+
+  struct DiagnosticLogEntry {
+    base::Time time;
+    std::string file;
+    int line = 0;
+    int verbose_level = 0;
+    std::string message;
+  };
 
   void OnConnectionClosed(const ledger::type::Result result);
 
@@ -569,22 +578,21 @@ class RewardsServiceImpl : public RewardsService,
       SavePublisherInfoCallback callback,
       const ledger::type::Result result);
 
-  bool MaybeTailDiagnosticLog(
-      const int num_lines);
-
   void DiagnosticLog(
       const std::string& file,
       const int line,
       const int verbose_level,
       const std::string& message) override;
 
-  bool WriteToDiagnosticLogOnFileTaskRunner(
+  void FlushDiagnosticLog();
+
+  void DiscardPendingDiagnosticLog();
+
+  static bool WriteToDiagnosticLogOnFileTaskRunner(
       const base::FilePath& log_path,
-      const int num_lines,
-      const std::string& file,
-      const int line,
-      const int verbose_level,
-      const std::string& message);
+      const base::FilePath& rotated_log_path,
+      const bool start_session,
+      const std::vector<DiagnosticLogEntry>& entries);
 
   void OnWriteToLogOnFileTaskRunner(
     const bool success);
@@ -595,6 +603,7 @@ class RewardsServiceImpl : public RewardsService,
 
   std::string LoadDiagnosticLogOnFileTaskRunner(
       const base::FilePath& path,
+      const base::FilePath& rotated_path,
       const int num_lines);
 
   void OnLoadDiagnosticLogOnFileTaskRunner(
@@ -606,7 +615,8 @@ class RewardsServiceImpl : public RewardsService,
   void CompleteReset(SuccessCallback callback) override;
 
   bool ClearDiagnosticLogOnFileTaskRunner(
-      const base::FilePath& path);
+      const base::FilePath& path,
+      const base::FilePath& rotated_path);
 
   void OnClearDiagnosticLogOnFileTaskRunner(
       ClearDiagnosticLogCallback callback,
@@ -776,7 +786,10 @@ class RewardsServiceImpl : public RewardsService,
   mojo::Remote<bat_ledger::mojom::BatLedgerService> bat_ledger_service_;
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
   const base::FilePath diagnostic_log_path_;
-  base::File diagnostic_log_;
+  const base::FilePath rotated_diagnostic_log_path_;
+  std::vector<DiagnosticLogEntry> pending_diagnostic_log_entries_;
+  base::OneShotTimer diagnostic_log_flush_timer_;
+  bool diagnostic_log_session_started_ = false;
   const base::FilePath ledger_state_path_;
   const base::FilePath publisher_state_path_;
   const base::FilePath publisher_info_db_path_;
@@ -4,7 +4,9 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <map>
+#include <string>
 
+#include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "bat/ledger/mojom_structs.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
@@ -75,6 +77,22 @@ class RewardsServiceTest : public testing::Test {
   Profile* profile() { return profile_.get(); }
   RewardsServiceImpl* rewards_service() { return rewards_service_; }
   MockRewardsServiceObserver* observer() { return observer_.get(); }
+  const base::FilePath& temp_path() const { return temp_dir_.GetPath(); }
+
+  bool WriteToDiagnosticLog(
+      const base::FilePath& path,
+      const bool start_session,
+      const std::string& message) {
+    RewardsServiceImpl::DiagnosticLogEntry entry;
+    entry.time = base::Time::Now();
+    entry.file = "rewards_service_impl_unittest.cc";
+    entry.line = 1;
+    entry.verbose_level = 1;
+    entry.message = message;
+
+    return RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner(path,
+        temp_path().AppendASCII("Rewards.log.1"), start_session, {entry});
+  }
 
  private:
   // Need this as a very first member to run tests in UI thread
@@ -87,6 +105,30 @@ class RewardsServiceTest : public testing::Test {
   base::ScopedTempDir temp_dir_;
 };
 
+TEST_F(RewardsServiceTest, DiagnosticLogBatchesOfOneSessionShareOneDivider) {
+  const base::FilePath path = temp_path().AppendASCII("Rewards.log");
+  const std::string previous_session = "previous session\n";
+  ASSERT_EQ(static_cast<int>(previous_session.size()), base::WriteFile(path,
+      previous_session.c_str(), previous_session.size()));
+
+  ASSERT_TRUE(WriteToDiagnosticLog(path, true, "first batch"));
+  ASSERT_TRUE(WriteToDiagnosticLog(path, false, "second batch"));
+
+  std::string log;
+  ASSERT_TRUE(base::ReadFileToString(path, &log));
+
+  const std::string divider(80, '-');
+  size_t divider_count = 0;
+  for (size_t pos = log.find(divider); pos != std::string::npos;
+       pos = log.find(divider, pos + divider.size())) {
+    divider_count++;
+  }
+
+  EXPECT_EQ(1u, divider_count);
+  EXPECT_LT(log.find(divider), log.find("first batch"));
+  EXPECT_LT(log.find("first batch"), log.find("second batch"));
+}
+
 // add test for strange entries
 
 }  // namespace brave_rewards
@@ -16,10 +16,12 @@
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_network_util.h"
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_response.h"
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_util.h"
+#include "brave/components/brave_rewards/common/pref_names.h"
 #include "chrome/browser/ui/views/frame/browser_view.h"
 #include "chrome/common/chrome_paths.h"
 #include "chrome/test/base/in_process_browser_test.h"
 #include "chrome/test/base/testing_profile.h"
+#include "components/prefs/pref_service.h"
 #include "content/public/test/browser_test.h"
 #include "net/dns/mock_host_resolver.h"
 #include "sql/database.h"
@@ -896,4 +898,25 @@ IN_PROC_BROWSER_TEST_F(
   }
 }
 
+IN_PROC_BROWSER_TEST_F(
+    RewardsDatabaseBrowserTest,
+    Migration_30_PublisherPrefixList) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  const uint64_t stamp = 1606136400;
+  PrefService* prefs = browser()->profile()->GetPrefs();
+  prefs->SetUint64(brave_rewards::prefs::kServerPublisherListStamp, stamp);
+
+  InitDB();
+
+  EXPECT_TRUE(db_.DoesColumnExist("publisher_prefix_list", "prefix_size"));
+  EXPECT_TRUE(db_.DoesColumnExist("publisher_prefix_list", "prefixes"));
+  EXPECT_FALSE(db_.DoesColumnExist("publisher_prefix_list", "hash_prefix"));
+
+  // The stamp is cleared once the migration succeeded so that the prefix
+  // list is fetched again in the new format
+  EXPECT_NE(
+      prefs->GetUint64(brave_rewards::prefs::kServerPublisherListStamp),
+      stamp);
+}
+
 }  // namespace rewards_browsertest
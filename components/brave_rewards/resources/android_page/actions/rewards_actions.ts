@@ -61,6 +61,11 @@ export const onContributeList = (list: Rewards.Publisher[]) => action(types.ON_C
   list
 })
 
+export const onContributeListChanged = (changes: {updated: Rewards.Publisher[], removed: string[]}) => action(types.ON_CONTRIBUTE_LIST_CHANGED, {
+  updated: changes.updated,
+  removed: changes.removed
+})
+
 export const onExcludedList = (list: Rewards.ExcludedPublisher[]) => action(types.ON_EXCLUDED_LIST, {
   list
 })
@@ -19,6 +19,42 @@ const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.St
 
       state.autoContributeList = action.payload.list
       break
+    case types.ON_CONTRIBUTE_LIST_CHANGED: {
+      const updated: Rewards.Publisher[] = action.payload.updated || []
+      const removed: string[] = action.payload.removed || []
+
+      const updatedById: Record<string, Rewards.Publisher> = {}
+      updated.forEach((publisher: Rewards.Publisher) => {
+        updatedById[publisher.id] = publisher
+      })
+
+      // Keep the current order, replacing updated rows in place and appending
+      // the publishers which were not in the list yet
+      const list: Rewards.Publisher[] = []
+      const currentList = state.autoContributeList || []
+      currentList.forEach((publisher: Rewards.Publisher) => {
+        if (removed.includes(publisher.id)) {
+          return
+        }
+
+        const update = updatedById[publisher.id]
+        if (update) {
+          list.push(update)
+          delete updatedById[publisher.id]
+          return
+        }
+
+        list.push(publisher)
+      })
+
+      Object.keys(updatedById).forEach((id: string) => {
+        list.push(updatedById[id])
+      })
+
+      state = { ...state }
+      state.autoContributeList = list
+      break
+    }
     case types.ON_EXCLUDED_LIST: {
       if (!action.payload.list) {
         break
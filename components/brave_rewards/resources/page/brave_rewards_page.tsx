@@ -91,6 +91,10 @@ window.cr.define('brave_rewards', function () {
     getActions().onContributeList(list)
   }
 
+  function contributeListChanged (changes: {updated: Rewards.Publisher[], removed: string[]}) {
+    getActions().onContributeListChanged(changes)
+  }
+
   function excludedList (list: Rewards.ExcludedPublisher[]) {
     getActions().onExcludedList(list)
   }
@@ -274,6 +278,7 @@ window.cr.define('brave_rewards', function () {
     promotionFinish,
     reconcileStamp,
     contributeList,
+    contributeListChanged,
     excludedList,
     balanceReport,
     contributionAmount,
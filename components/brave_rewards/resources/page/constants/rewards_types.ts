@@ -24,6 +24,7 @@ export const enum types {
   ON_CLEAR_ALERT = '@@rewards/ON_CLEAR_ALERT',
   ON_RECONCILE_STAMP = '@@rewards/ON_RECONCILE_STAMP',
   ON_CONTRIBUTE_LIST = '@@rewards/ON_CONTRIBUTE_LIST',
+  ON_CONTRIBUTE_LIST_CHANGED = '@@rewards/ON_CONTRIBUTE_LIST_CHANGED',
   ON_EXCLUDE_PUBLISHER = '@@rewards/ON_EXCLUDE_PUBLISHER',
   ON_RESTORE_PUBLISHERS = '@@rewards/ON_RESTORE_PUBLISHERS',
   ON_EXCLUDED_PUBLISHERS_NUMBER = '@@rewards/ON_EXCLUDED_PUBLISHERS_NUMBER',
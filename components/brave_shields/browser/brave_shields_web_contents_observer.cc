@@ -136,6 +136,8 @@ BraveShieldsWebContentsObserver::~BraveShieldsWebContentsObserver() {
 BraveShieldsWebContentsObserver::BraveShieldsWebContentsObserver(
     WebContents* web_contents)
     : WebContentsObserver(web_contents) {
+  content_settings_observer_.Add(HostContentSettingsMapFactory::GetForProfile(
+      Profile::FromBrowserContext(web_contents->GetBrowserContext())));
 }
 
 void BraveShieldsWebContentsObserver::RenderFrameCreated(
@@ -177,6 +179,12 @@ void BraveShieldsWebContentsObserver::RenderFrameHostChanged(
 
 void BraveShieldsWebContentsObserver::DidFinishNavigation(
     content::NavigationHandle* navigation_handle) {
+  if (navigation_handle->IsInMainFrame() &&
+      navigation_handle->HasCommitted() &&
+      !navigation_handle->IsSameDocument()) {
+    shields_settings_.reset();
+  }
+
   RenderFrameHost* main_frame = web_contents()->GetMainFrame();
   if (!web_contents() || !main_frame) {
     return;
@@ -210,6 +218,42 @@ GURL BraveShieldsWebContentsObserver::GetTabURLFromRenderFrameInfo(
   return GURL();
 }
 
+// static
+ShieldsSettingsSnapshot
+BraveShieldsWebContentsObserver::GetShieldsSettingsFromRenderFrameInfo(
+    HostContentSettingsMap* map,
+    const GURL& tab_origin,
+    int render_process_id,
+    int render_frame_id,
+    int render_frame_tree_node_id) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  WebContents* web_contents = GetWebContents(
+      render_process_id, render_frame_id, render_frame_tree_node_id);
+  BraveShieldsWebContentsObserver* observer =
+      web_contents ? FromWebContents(web_contents) : nullptr;
+  if (!observer)
+    return ShieldsSettingsSnapshot(map, tab_origin);
+
+  if (!observer->shields_settings_ ||
+      observer->shields_settings_->tab_origin() != tab_origin) {
+    observer->shields_settings_.emplace(map, tab_origin);
+  }
+  return *observer->shields_settings_;
+}
+
+void BraveShieldsWebContentsObserver::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsType content_type,
+    const std::string& resource_identifier) {
+  // DEFAULT is reported when several or all content setting types changed at
+  // once, e.g. when a default setting is reset.
+  if (content_type == ContentSettingsType::PLUGINS ||
+      content_type == ContentSettingsType::DEFAULT)
+    shields_settings_.reset();
+}
+
 bool BraveShieldsWebContentsObserver::IsBlockedSubresource(
     const std::string& subresource) {
   return blocked_url_paths_.find(subresource) != blocked_url_paths_.end();
@@ -12,8 +12,13 @@
 #include <vector>
 
 #include "base/macros.h"
+#include "base/optional.h"
+#include "base/scoped_observer.h"
 #include "base/synchronization/lock.h"
 #include "base/strings/string16.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/browser/web_contents_user_data.h"
 
@@ -26,7 +31,8 @@ class PrefRegistrySimple;
 namespace brave_shields {
 
 class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
-    public content::WebContentsUserData<BraveShieldsWebContentsObserver> {
+    public content::WebContentsUserData<BraveShieldsWebContentsObserver>,
+    public content_settings::Observer {
  public:
   explicit BraveShieldsWebContentsObserver(content::WebContents*);
   ~BraveShieldsWebContentsObserver() override;
@@ -44,6 +50,14 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
   static GURL GetTabURLFromRenderFrameInfo(int render_process_id,
                                            int render_frame_id,
                                            int render_frame_tree_node_id);
+  // Returns the shields settings of |tab_origin|, reusing the ones of the
+  // tab the frame belongs to while its origin and the settings don't change.
+  static ShieldsSettingsSnapshot GetShieldsSettingsFromRenderFrameInfo(
+      HostContentSettingsMap* map,
+      const GURL& tab_origin,
+      int render_process_id,
+      int render_frame_id,
+      int render_frame_tree_node_id);
   void AllowScriptsOnce(const std::vector<std::string>& origins,
                         content::WebContents* web_contents);
   bool IsBlockedSubresource(const std::string& subresource);
@@ -75,6 +89,12 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
   void DidFinishNavigation(
       content::NavigationHandle* navigation_handle) override;
 
+  // content_settings::Observer overrides.
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsType content_type,
+                               const std::string& resource_identifier) override;
+
   // Invoked if an IPC message is coming from a specific RenderFrameHost.
   bool OnMessageReceived(const IPC::Message& message,
       content::RenderFrameHost* render_frame_host) override;
@@ -98,6 +118,10 @@ class BraveShieldsWebContentsObserver : public content::WebContentsObserver,
   // We keep a set of the current page's blocked URLs in case the page
   // continually tries to load the same blocked URLs.
   std::set<std::string> blocked_url_paths_;
+  // Shields settings of the last tab origin requests were made for.
+  base::Optional<ShieldsSettingsSnapshot> shields_settings_;
+  ScopedObserver<HostContentSettingsMap, content_settings::Observer>
+      content_settings_observer_{this};
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
   DISALLOW_COPY_AND_ASSIGN(BraveShieldsWebContentsObserver);
@@ -0,0 +1,28 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+
+namespace brave_shields {
+
+ShieldsSettingsSnapshot::ShieldsSettingsSnapshot(HostContentSettingsMap* map,
+                                                 const GURL& tab_origin)
+    : tab_origin_(tab_origin),
+      brave_shields_enabled_(GetBraveShieldsEnabled(map, tab_origin)),
+      allow_ads_(GetAdControlType(map, tab_origin) == ControlType::ALLOW),
+      https_everywhere_enabled_(GetHTTPSEverywhereEnabled(map, tab_origin)),
+      allow_referrers_(AllowReferrers(map, tab_origin)) {}
+
+ShieldsSettingsSnapshot::ShieldsSettingsSnapshot(
+    const ShieldsSettingsSnapshot&) = default;
+
+ShieldsSettingsSnapshot& ShieldsSettingsSnapshot::operator=(
+    const ShieldsSettingsSnapshot&) = default;
+
+ShieldsSettingsSnapshot::~ShieldsSettingsSnapshot() = default;
+
+}  // namespace brave_shields
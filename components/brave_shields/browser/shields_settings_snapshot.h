@@ -0,0 +1,41 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+
+#include "url/gurl.h"
+
+class HostContentSettingsMap;
+
+namespace brave_shields {
+
+// The shields settings of a tab origin which the network request pipeline
+// checks for every request. Resolving them once per tab origin spares each
+// request a content settings lookup per setting.
+class ShieldsSettingsSnapshot {
+ public:
+  ShieldsSettingsSnapshot(HostContentSettingsMap* map, const GURL& tab_origin);
+  ShieldsSettingsSnapshot(const ShieldsSettingsSnapshot&);
+  ShieldsSettingsSnapshot& operator=(const ShieldsSettingsSnapshot&);
+  ~ShieldsSettingsSnapshot();
+
+  const GURL& tab_origin() const { return tab_origin_; }
+  bool brave_shields_enabled() const { return brave_shields_enabled_; }
+  bool allow_ads() const { return allow_ads_; }
+  bool https_everywhere_enabled() const { return https_everywhere_enabled_; }
+  bool allow_referrers() const { return allow_referrers_; }
+
+ private:
+  GURL tab_origin_;
+  bool brave_shields_enabled_;
+  bool allow_ads_;
+  bool https_everywhere_enabled_;
+  bool allow_referrers_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
@@ -0,0 +1,95 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_match_index.h"
+
+#include <algorithm>
+#include <map>
+
+SiteMatchIndex::SiteMatchIndex(const std::vector<std::string>& strings)
+    : strings_(strings) {
+  std::map<NGram, std::vector<size_t>> positions_for_ngram;
+  for (size_t i = 0; i < strings_.size(); ++i) {
+    const std::string& string = strings_[i];
+    for (size_t pos = 0; pos + kNGramLength <= string.length(); ++pos) {
+      std::vector<size_t>& positions =
+          positions_for_ngram[MakeNGram(string, pos)];
+      // Strings are visited in order, so a string containing the same
+      // n-gram twice can only be the last one added.
+      if (positions.empty() || positions.back() != i)
+        positions.push_back(i);
+    }
+    sorted_strings_.emplace_back(string, i);
+  }
+  positions_for_ngram_ = base::flat_map<NGram, std::vector<size_t>>(
+      positions_for_ngram.begin(), positions_for_ngram.end());
+  std::sort(sorted_strings_.begin(), sorted_strings_.end());
+}
+
+SiteMatchIndex::~SiteMatchIndex() = default;
+
+std::vector<size_t> SiteMatchIndex::FindContaining(
+    base::StringPiece text,
+    size_t max_matches) const {
+  std::vector<size_t> matches;
+
+  if (text.length() < kNGramLength) {
+    // Too short to be indexed, but short text is found in most strings so
+    // this stops early.
+    for (size_t i = 0;
+         i < strings_.size() && matches.size() < max_matches; ++i) {
+      if (strings_[i].find(text.data(), 0, text.length()) !=
+          std::string::npos) {
+        matches.push_back(i);
+      }
+    }
+    return matches;
+  }
+
+  // Every string containing |text| contains all of its n-grams, so only the
+  // strings for its rarest n-gram have to be compared.
+  const std::vector<size_t>* candidates = nullptr;
+  for (size_t pos = 0; pos + kNGramLength <= text.length(); ++pos) {
+    const auto it = positions_for_ngram_.find(MakeNGram(text, pos));
+    if (it == positions_for_ngram_.end())
+      return matches;
+    if (!candidates || it->second.size() < candidates->size())
+      candidates = &it->second;
+  }
+
+  for (size_t i : *candidates) {
+    if (matches.size() >= max_matches)
+      break;
+    if (strings_[i].find(text.data(), 0, text.length()) != std::string::npos)
+      matches.push_back(i);
+  }
+  return matches;
+}
+
+std::vector<size_t> SiteMatchIndex::FindStartingWith(
+    base::StringPiece text) const {
+  std::vector<size_t> matches;
+  auto it = std::lower_bound(
+      sorted_strings_.begin(), sorted_strings_.end(), text,
+      [](const std::pair<std::string, size_t>& entry, base::StringPiece text) {
+        return base::StringPiece(entry.first) < text;
+      });
+  for (; it != sorted_strings_.end() &&
+         base::StringPiece(it->first).starts_with(text);
+       ++it) {
+    matches.push_back(it->second);
+  }
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+// static
+SiteMatchIndex::NGram SiteMatchIndex::MakeNGram(base::StringPiece text,
+                                                size_t pos) {
+  NGram ngram = 0;
+  for (size_t i = 0; i < kNGramLength; ++i)
+    ngram = (ngram << 8) | static_cast<uint8_t>(text[pos + i]);
+  return ngram;
+}
@@ -0,0 +1,55 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/macros.h"
+#include "base/strings/string_piece.h"
+
+// Indexes a fixed list of strings used by the omnibox providers, so that the
+// strings containing or starting with the typed text are found without
+// comparing against every string on each keystroke. Lookups return positions
+// in the original list in ascending order, so callers keep the list order.
+class SiteMatchIndex {
+ public:
+  explicit SiteMatchIndex(const std::vector<std::string>& strings);
+  ~SiteMatchIndex();
+
+  // Returns the positions of the first |max_matches| strings which contain
+  // |text|.
+  std::vector<size_t> FindContaining(base::StringPiece text,
+                                     size_t max_matches) const;
+
+  // Returns the positions of all strings which start with |text|.
+  std::vector<size_t> FindStartingWith(base::StringPiece text) const;
+
+ private:
+  static constexpr size_t kNGramLength = 3;
+
+  using NGram = uint32_t;
+
+  static NGram MakeNGram(base::StringPiece text, size_t pos);
+
+  std::vector<std::string> strings_;
+
+  // Positions of the strings containing each n-gram, in ascending order.
+  base::flat_map<NGram, std::vector<size_t>> positions_for_ngram_;
+
+  // Strings and their positions, sorted by string.
+  std::vector<std::pair<std::string, size_t>> sorted_strings_;
+
+  DISALLOW_COPY_AND_ASSIGN(SiteMatchIndex);
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
@@ -0,0 +1,53 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_match_index.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const std::vector<std::string> kSites = {
+    "google.com",  "youtube.com", "wikipedia.org", "goo.gl",
+    "youtu.be",    "bing.com",    "booking.com",   "tube.com",
+};
+
+}  // namespace
+
+TEST(SiteMatchIndexTest, FindContainingShortText) {
+  SiteMatchIndex index(kSites);
+  EXPECT_EQ(std::vector<size_t>({0, 3}), index.FindContaining("go", 10));
+  EXPECT_EQ(std::vector<size_t>({0}), index.FindContaining("go", 1));
+  EXPECT_EQ(std::vector<size_t>({}), index.FindContaining("zz", 10));
+}
+
+TEST(SiteMatchIndexTest, FindContaining) {
+  SiteMatchIndex index(kSites);
+  EXPECT_EQ(std::vector<size_t>({1, 4}), index.FindContaining("yout", 10));
+  EXPECT_EQ(std::vector<size_t>({1, 7}), index.FindContaining("tube.", 10));
+  EXPECT_EQ(std::vector<size_t>({1}), index.FindContaining("tube.", 1));
+  EXPECT_EQ(std::vector<size_t>({0, 1, 5, 6, 7}),
+            index.FindContaining(".com", 10));
+  EXPECT_EQ(std::vector<size_t>({}), index.FindContaining("gle.org", 10));
+  EXPECT_EQ(std::vector<size_t>({}), index.FindContaining("zzz", 10));
+}
+
+TEST(SiteMatchIndexTest, FindContainingRepeatedNGram) {
+  SiteMatchIndex index({"aaaa", "aaa", "baaab"});
+  EXPECT_EQ(std::vector<size_t>({0, 1, 2}), index.FindContaining("aaa", 10));
+  EXPECT_EQ(std::vector<size_t>({0}), index.FindContaining("aaaa", 10));
+}
+
+TEST(SiteMatchIndexTest, FindStartingWith) {
+  SiteMatchIndex index(kSites);
+  EXPECT_EQ(std::vector<size_t>({1, 4}), index.FindStartingWith("you"));
+  EXPECT_EQ(std::vector<size_t>({0, 3}), index.FindStartingWith("goo"));
+  EXPECT_EQ(std::vector<size_t>({2}), index.FindStartingWith("wikipedia.org"));
+  EXPECT_EQ(std::vector<size_t>({}), index.FindStartingWith("ube"));
+  EXPECT_EQ(kSites.size(), index.FindStartingWith("").size());
+}
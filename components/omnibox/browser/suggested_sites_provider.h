@@ -17,6 +17,7 @@
 #include "components/omnibox/browser/autocomplete_provider.h"
 
 class AutocompleteProviderClient;
+class SiteMatchIndex;
 
 // This is the provider for Brave Suggested Sites
 class SuggestedSitesProvider : public AutocompleteProvider {
@@ -32,6 +33,7 @@ class SuggestedSitesProvider : public AutocompleteProvider {
   static const int kRelevance;
 
   const std::vector<SuggestedSitesMatch>& GetSuggestedSites();
+  const SiteMatchIndex& GetSuggestedSitesIndex();
   void AddMatch(const SuggestedSitesMatch& match,
                 const ACMatchClassifications& styles);
 
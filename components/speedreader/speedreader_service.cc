@@ -9,7 +9,7 @@
 #include "base/metrics/histogram_macros.h"
 #include "brave/components/speedreader/features.h"
 #include "brave/components/speedreader/speedreader_pref_names.h"
-#include "brave/components/weekly_storage/weekly_storage.h"
+#include "brave/components/weekly_storage/weekly_storage_service.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 
@@ -53,11 +53,13 @@ void StoreTogglesHistogram(uint64_t toggles) {
   UMA_HISTOGRAM_EXACT_LINEAR(kSpeedreaderToggleUMAHistogramName, bucket, 5);
 }
 
-void RecordHistograms(PrefService* prefs, bool toggled, bool enabled_now) {
-  WeeklyStorage weekly_toggles(prefs, kSpeedreaderPrefToggleCount);
-  if (toggled)
-    weekly_toggles.AddDelta(1);
-  const uint64_t toggle_count = weekly_toggles.GetWeeklySum();
+void RecordHistograms(PrefService* prefs,
+                      WeeklyStorageService* weekly_storage,
+                      bool toggled,
+                      bool enabled_now) {
+  const uint64_t toggle_count =
+      toggled ? weekly_storage->AddDelta(kSpeedreaderPrefToggleCount, 1)
+              : weekly_storage->GetWeeklySum(kSpeedreaderPrefToggleCount);
   StoreTogglesHistogram(toggle_count);
 
   // Has been "recently" enabled if currently enabled,
@@ -74,7 +76,11 @@ void RecordHistograms(PrefService* prefs, bool toggled, bool enabled_now) {
 
 }  // namespace
 
-SpeedreaderService::SpeedreaderService(PrefService* prefs) : prefs_(prefs) {}
+SpeedreaderService::SpeedreaderService(PrefService* prefs,
+                                       WeeklyStorageService* weekly_storage)
+    : prefs_(prefs), weekly_storage_(weekly_storage) {
+  DCHECK(weekly_storage);
+}
 
 SpeedreaderService::~SpeedreaderService() {}
 
@@ -90,7 +96,7 @@ void SpeedreaderService::ToggleSpeedreader() {
   prefs_->SetBoolean(kSpeedreaderPrefEnabled, !enabled);
   if (!enabled)
     prefs_->SetBoolean(kSpeedreaderPrefEverEnabled, true);
-  RecordHistograms(prefs_, true,
+  RecordHistograms(prefs_, weekly_storage_, true,
                    !enabled);  // toggling - now enabled
 }
 
@@ -100,7 +106,7 @@ bool SpeedreaderService::IsEnabled() {
   }
 
   const bool enabled = prefs_->GetBoolean(kSpeedreaderPrefEnabled);
-  RecordHistograms(prefs_, false, enabled);
+  RecordHistograms(prefs_, weekly_storage_, false, enabled);
   return enabled;
 }
 
@@ -12,12 +12,13 @@
 
 class PrefRegistrySimple;
 class PrefService;
+class WeeklyStorageService;
 
 namespace speedreader {
 
 class SpeedreaderService : public KeyedService {
  public:
-  explicit SpeedreaderService(PrefService* prefs);
+  SpeedreaderService(PrefService* prefs, WeeklyStorageService* weekly_storage);
   ~SpeedreaderService() override;
 
   static void RegisterPrefs(PrefRegistrySimple* registry);
@@ -30,6 +31,7 @@ class SpeedreaderService : public KeyedService {
 
  private:
   PrefService* prefs_ = nullptr;
+  WeeklyStorageService* weekly_storage_ = nullptr;
 };
 
 }  // namespace speedreader
@@ -78,4 +78,52 @@ describe('publishers reducer', () => {
       })
     })
   })
+
+  describe('ON_CONTRIBUTE_LIST_CHANGED', () => {
+    const getPublisher = (id: string, percentage: number): Rewards.Publisher => {
+      return {
+        publisherKey: id,
+        percentage,
+        status: 0,
+        excluded: 0,
+        url: `https://${id}`,
+        name: id,
+        provider: '',
+        favIcon: '',
+        id,
+        weight: percentage
+      }
+    }
+
+    it('applies updated and removed publishers', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [
+        getPublisher('foo.com', 50),
+        getPublisher('bar.com', 30),
+        getPublisher('baz.com', 20)
+      ]
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST_CHANGED,
+        payload: {
+          updated: [
+            getPublisher('qux.com', 10),
+            getPublisher('bar.com', 40)
+          ],
+          removed: ['baz.com']
+        }
+      })
+
+      const expectedState: Rewards.State = { ...defaultState }
+      expectedState.autoContributeList = [
+        getPublisher('foo.com', 50),
+        getPublisher('bar.com', 40),
+        getPublisher('qux.com', 10)
+      ]
+
+      expect(assertion).toEqual({
+        rewardsData: expectedState
+      })
+    })
+  })
 })
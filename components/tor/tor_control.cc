@@ -5,6 +5,8 @@
 
 #include "brave/components/tor/tor_control.h"
 
+#include <algorithm>
+
 #include "base/bind_helpers.h"
 #include "base/files/file.h"
 #include "base/files/file_path_watcher.h"
@@ -941,39 +943,48 @@ void TorControl::ReadDone(int rv) {
     Error();
     return;
   }
-  const char* data = readiobuf_->data();
-  for (int i = 0; i < rv; i++) {
+  // Scan the new input for line breaks, skipping directly over line
+  // content, and hand each complete line to ReadLine() as a view into
+  // the buffer rather than a copy.
+  const char* const start = readiobuf_->StartOfBuffer();
+  const char* const end = readiobuf_->data() + rv;
+  const char* p = readiobuf_->data();
+  while (p < end) {
     if (!read_cr_) {
       // No CR yet.  Accept CR or non-LF; reject LF.
-      if (data[i] == 0x0d) {  // CR
-        read_cr_ = true;
-      } else if (data[i] == 0x0a) {  // LF
+      p = std::find_if(p, end, [](char ch) {
+        return ch == 0x0d || ch == 0x0a;  // CR or LF
+      });
+      if (p == end)
+        break;
+      if (*p == 0x0a) {  // LF
         VLOG(1) << "tor: stray line feed";
         Error();
         return;
-      } else {
-        // Anything else: Just accept it and move on.
-      }
-    } else {
-      // CR seen.  Accept LF; reject all else.
-      if (data[i] == 0x0a) {  // LF
-        // CRLF seen, so we must have i >= 2.  Emit a line and advance
-        // to the next one, unless anything went wrong with the line.
-        assert(i >= 1);
-        std::string line(readiobuf_->StartOfBuffer() + read_start_,
-                         readiobuf_->offset() + i - 1 - read_start_);
-        read_start_ = readiobuf_->offset() + i + 1;
-        read_cr_ = false;
-        if (!ReadLine(line)) {
-          reading_ = false;
-          return;
-        }
-      } else {
-        // CR seen, but not LF.  Bad.
-        VLOG(1) << "tor: stray carriage return";
-        Error();
-        return;
       }
+      read_cr_ = true;
+      p++;
+      continue;
+    }
+
+    // CR seen.  Accept LF; reject all else.
+    if (*p != 0x0a) {  // LF
+      // CR seen, but not LF.  Bad.
+      VLOG(1) << "tor: stray carriage return";
+      Error();
+      return;
+    }
+
+    // CRLF seen.  Emit a line and advance to the next one, unless
+    // anything went wrong with the line.
+    const base::StringPiece line(start + read_start_,
+                                 p - 1 - (start + read_start_));
+    read_start_ = p + 1 - start;
+    read_cr_ = false;
+    p++;
+    if (!ReadLine(line)) {
+      reading_ = false;
+      return;
     }
   }
 
@@ -1017,7 +1028,7 @@ void TorControl::ReadDone(int rv) {
 //      We have read a line of input; process it.  Return true on
 //      success, false on error.
 //
-bool TorControl::ReadLine(const std::string& line) {
+bool TorControl::ReadLine(base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
 
   if (line.size() < 4) {
@@ -1032,9 +1043,9 @@ bool TorControl::ReadLine(const std::string& line) {
   // intermediate reply and ` ' for a final reply.
   //
   // TODO(riastradh): parse or check syntax of status
-  std::string status(line, 0, 3);
-  char pos = line[3];
-  std::string reply(line, 4);
+  const base::StringPiece status = line.substr(0, 3);
+  const char pos = line[3];
+  const base::StringPiece reply = line.substr(4);
 
   // Determine whether it is an asynchronous reply, status 6yz.
   if (status[0] == '6') {
@@ -1045,8 +1056,8 @@ bool TorControl::ReadLine(const std::string& line) {
     if (!async_) {
       // Parse the keyword and the initial line.
       const size_t sp = reply.find(' ');
-      std::string event_name, initial;
-      if (sp == std::string::npos) {
+      base::StringPiece event_name, initial;
+      if (sp == base::StringPiece::npos) {
         event_name = reply;
       } else {
         event_name = reply.substr(0, sp);
@@ -1074,7 +1085,7 @@ bool TorControl::ReadLine(const std::string& line) {
 
           // Notify the delegate of the parsed reply.  No extra
           // because there were no intermediate reply lines.
-          NotifyTorEvent(event, initial, {});
+          NotifyTorEvent(event, std::string(initial), {});
 
           return true;
         }
@@ -1089,7 +1100,7 @@ bool TorControl::ReadLine(const std::string& line) {
                                                      : (*found).second);
           async_ = std::make_unique<Async>();
           async_->event = event;
-          async_->initial = initial;
+          async_->initial = std::string(initial);
           async_->skip = (event == TorControlEvent::INVALID);
           return true;
         }
@@ -1122,7 +1133,7 @@ bool TorControl::ReadLine(const std::string& line) {
             Error();
             return false;
           }
-          async_->extra[key] = value;
+          async_->extra[key] = std::move(value);
           return true;
         }
         case ' ': {
@@ -1140,12 +1151,13 @@ bool TorControl::ReadLine(const std::string& line) {
               Error();
               return false;
             }
-            async_->extra[key] = value;
+            async_->extra[key] = std::move(value);
 
             // If we're still subscribed, notify the delegate of the
-            // parsed reply.
+            // parsed reply, handing over the collected state.
             if (async_events_.count(async_->event)) {
-              NotifyTorEvent(async_->event, async_->initial, async_->extra);
+              NotifyTorEvent(async_->event, std::move(async_->initial),
+                             std::move(async_->extra));
             }
           }
           async_.reset();
@@ -1156,12 +1168,14 @@ bool TorControl::ReadLine(const std::string& line) {
   } else {
     // Synchronous reply.  Return it to the next command callback in
     // the queue.
+    const std::string status_string(status);
+    const std::string reply_string(reply);
     switch (pos) {
       case '-':
-        NotifyTorRawMid(status, reply);
+        NotifyTorRawMid(status_string, reply_string);
         if (!cmdq_.empty()) {
           PerLineCallback& perline = cmdq_.front().first;
-          perline.Run(status, reply);
+          perline.Run(status_string, reply_string);
         }
         return true;
       case '+':
@@ -1169,11 +1183,11 @@ bool TorControl::ReadLine(const std::string& line) {
         // XXX Just ignore it for now.
         return true;
       case ' ':
-        NotifyTorRawEnd(status, reply);
+        NotifyTorRawEnd(status_string, reply_string);
         if (!cmdq_.empty()) {
           CmdCallback& callback = cmdq_.front().second;
           bool error = false;
-          std::move(callback).Run(error, status, reply);
+          std::move(callback).Run(error, status_string, reply_string);
           cmdq_.pop();
         }
         return true;
@@ -1263,8 +1277,8 @@ void TorControl::NotifyTorCleanupNeeded(base::ProcessId id) {
 
 void TorControl::NotifyTorEvent(
     TorControlEvent event,
-    const std::string& initial,
-    const std::map<std::string, std::string>& extra) {
+    std::string initial,
+    std::map<std::string, std::string> extra) {
   content::GetUIThreadTaskRunner({})->PostTask(
       FROM_HERE, base::BindOnce(
                      [](base::WeakPtr<TorControl::Delegate> delegate,
@@ -1273,7 +1287,8 @@ void TorControl::NotifyTorEvent(
                        if (delegate)
                          delegate->OnTorEvent(event, initial, extra);
                      },
-                     delegate_->AsWeakPtr(), event, initial, extra));
+                     delegate_->AsWeakPtr(), event, std::move(initial),
+                     std::move(extra)));
 }
 
 void TorControl::NotifyTorRawCmd(const std::string& cmd) {
@@ -1287,8 +1302,8 @@ void TorControl::NotifyTorRawCmd(const std::string& cmd) {
                      delegate_->AsWeakPtr(), cmd));
 }
 
-void TorControl::NotifyTorRawAsync(const std::string& status,
-                                   const std::string& line) {
+void TorControl::NotifyTorRawAsync(base::StringPiece status,
+                                   base::StringPiece line) {
   content::GetUIThreadTaskRunner({})->PostTask(
       FROM_HERE, base::BindOnce(
                      [](base::WeakPtr<TorControl::Delegate> delegate,
@@ -1296,7 +1311,8 @@ void TorControl::NotifyTorRawAsync(const std::string& status,
                        if (delegate)
                          delegate->OnTorRawAsync(status, line);
                      },
-                     delegate_->AsWeakPtr(), status, line));
+                     delegate_->AsWeakPtr(), std::string(status),
+                     std::string(line)));
 }
 
 void TorControl::NotifyTorRawMid(const std::string& status,
@@ -1330,7 +1346,7 @@ void TorControl::NotifyTorRawEnd(const std::string& status,
 //      success, false on failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value) {
   size_t end;
@@ -1345,20 +1361,20 @@ bool TorControl::ParseKV(const std::string& string,
 //      failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value,
                          size_t* end) {
   DCHECK(key && value && end);
   // Search for `=' -- it had better be there.
-  size_t eq = string.find("=");
-  if (eq == std::string::npos)
+  size_t eq = string.find('=');
+  if (eq == base::StringPiece::npos)
     return false;
   size_t vstart = eq + 1;
 
   // If we're at the end of the string, value is empt.
   if (vstart == string.size()) {
-    *key = string.substr(0, eq);
+    *key = std::string(string.substr(0, eq));
     *value = "";
     *end = string.size();
     return true;
@@ -1368,7 +1384,7 @@ bool TorControl::ParseKV(const std::string& string,
   if (string[vstart] != '"') {
     // Not quoted.  Check for a delimiter.
     size_t i, vend = string.size();
-    if ((i = string.find(" ", vstart)) != std::string::npos) {
+    if ((i = string.find(' ', vstart)) != base::StringPiece::npos) {
       // Delimited.  Stop at the delimiter, and consume it.
       vend = i;
       *end = vend + 1;
@@ -1378,19 +1394,19 @@ bool TorControl::ParseKV(const std::string& string,
     }
 
     // Check for internal quotes; they are forbidden.
-    if ((i = string.find("\"", vstart)) != std::string::npos)
+    if ((i = string.find('"', vstart)) != base::StringPiece::npos)
       return false;
 
     // Extract the key and value and we're done.
-    *key = string.substr(0, eq);
-    *value = string.substr(vstart, vend - vstart);
+    *key = std::string(string.substr(0, eq));
+    *value = std::string(string.substr(vstart, vend - vstart));
     return true;
   }
 
   // Quoted string.  Parse it, and consume trailing spaces.
   if (!ParseQuoted(string.substr(eq + 1), value, end))
     return false;
-  *key = string.substr(0, eq);
+  *key = std::string(string.substr(0, eq));
   *end += eq + 1;
   while (*end < string.size() && string[*end] == ' ')
     (*end)++;
@@ -1405,7 +1421,7 @@ bool TorControl::ParseKV(const std::string& string,
 //      return false on failure.
 //
 // static
-bool TorControl::ParseQuoted(const std::string& string,
+bool TorControl::ParseQuoted(base::StringPiece string,
                              std::string* value,
                              size_t* end) {
   enum {
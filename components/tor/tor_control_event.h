@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_TOR_TOR_CONTROL_EVENT_H_
 #define BRAVE_COMPONENTS_TOR_TOR_CONTROL_EVENT_H_
 
+#include <functional>
 #include <map>
 #include <string>
 
@@ -18,7 +19,8 @@ enum class TorControlEvent {
 #undef TOR_EVENT
 };
 
-extern const std::map<std::string, TorControlEvent> kTorControlEventByName;
+extern const std::map<std::string, TorControlEvent, std::less<>>
+    kTorControlEventByName;
 extern const std::map<TorControlEvent, std::string> kTorControlEventByEnum;
 
 }  // namespace tor
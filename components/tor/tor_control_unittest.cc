@@ -5,11 +5,14 @@
 
 #include "brave/components/tor/tor_control.h"
 
+#include <string.h>
+
 #include "base/run_loop.h"
 #include "base/bind_helpers.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_task_environment.h"
+#include "net/base/io_buffer.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -179,4 +182,67 @@ TEST(TorControlTest, ReadLine) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST(TorControlTest, ReadDone) {
+  content::BrowserTaskEnvironment task_environment;
+
+  MockTorControlDelegate delegate;
+  std::unique_ptr<TorControl> control = TorControl::Create(&delegate);
+
+  using tor::TorControlEvent;
+  EXPECT_CALL(delegate, OnTorRawAsync("650", "NETWORK_LIVENESS UP")).Times(1);
+  EXPECT_CALL(delegate, OnTorRawAsync("650", "CIRC 1000 EXTENDED")).Times(1);
+  EXPECT_CALL(delegate, OnTorRawAsync("650", "PURPOSE=GENERAL")).Times(1);
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::NETWORK_LIVENESS, "UP",
+                                   testing::_)).Times(1);
+  std::map<std::string, std::string> circ_extra = {
+    {"PURPOSE", "GENERAL"}
+  };
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::CIRC, "1000 EXTENDED",
+                                   circ_extra)).Times(1);
+  content::GetIOThreadTaskRunner({})
+    ->PostTask(FROM_HERE,
+               base::BindOnce([](std::unique_ptr<TorControl> control) {
+                control->async_events_[TorControlEvent::NETWORK_LIVENESS] = 1;
+                control->async_events_[TorControlEvent::CIRC] = 1;
+                control->reading_ = true;
+                control->StartRead();
+
+                // Lines may be split anywhere across reads, including
+                // between CR and LF.
+                const char* reads[] = {
+                  "650 NETWORK_LIVENESS UP\r\n650-CIRC 10",
+                  "00 EXTENDED\r",
+                  "\n650 PURPOSE=GENERAL\r\n",
+                };
+                for (const char* read : reads) {
+                  const int len = strlen(read);
+                  memcpy(control->readiobuf_->data(), read, len);
+                  control->ReadDone(len);
+                  EXPECT_TRUE(control->reading_);
+                }
+                EXPECT_FALSE(control->async_);
+                EXPECT_FALSE(control->read_cr_);
+               }, std::move(control)));
+
+  base::RunLoop().RunUntilIdle();
+
+  EXPECT_CALL(delegate, OnTorClosed()).Times(1);
+  control = TorControl::Create(&delegate);
+  content::GetIOThreadTaskRunner({})
+    ->PostTask(FROM_HERE,
+               base::BindOnce([](std::unique_ptr<TorControl> control) {
+                control->async_events_[TorControlEvent::CIRC] = 1;
+                control->reading_ = true;
+                control->StartRead();
+
+                // Stray line feed
+                const char read[] = "650 CIRC 1000 EXTENDED\n";
+                memcpy(control->readiobuf_->data(), read, strlen(read));
+                control->ReadDone(strlen(read));
+                EXPECT_FALSE(control->reading_);
+               }, std::move(control)));
+
+  base::RunLoop().RunUntilIdle();
+}
+
 }  // namespace tor
@@ -5,6 +5,7 @@
 
 #include "brave/components/weekly_storage/weekly_storage.h"
 
+#include <algorithm>
 #include <numeric>
 #include <utility>
 
@@ -21,7 +22,7 @@ constexpr size_t kDaysInWeek = 7;
 WeeklyStorage::WeeklyStorage(PrefService* prefs, const char* pref_name)
     : prefs_(prefs),
       pref_name_(pref_name),
-      clock_(std::make_unique<base::DefaultClock>()) {
+      clock_(base::DefaultClock::GetInstance()) {
   DCHECK(pref_name);
   if (prefs) {
     Load();
@@ -31,15 +32,33 @@ WeeklyStorage::WeeklyStorage(PrefService* prefs, const char* pref_name)
 WeeklyStorage::WeeklyStorage(PrefService* prefs,
                              const char* pref_name,
                              std::unique_ptr<base::Clock> clock)
-    : prefs_(prefs), pref_name_(pref_name), clock_(std::move(clock)) {
+    : prefs_(prefs),
+      pref_name_(pref_name),
+      owned_clock_(std::move(clock)),
+      clock_(owned_clock_.get()) {
+  DCHECK(prefs);
+  DCHECK(pref_name);
+  Load();
+}
+
+WeeklyStorage::WeeklyStorage(PrefService* prefs,
+                             const char* pref_name,
+                             base::Clock* clock)
+    : prefs_(prefs), pref_name_(pref_name), clock_(clock) {
   DCHECK(prefs);
   DCHECK(pref_name);
+  DCHECK(clock);
   Load();
 }
 
 WeeklyStorage::~WeeklyStorage() = default;
 
 void WeeklyStorage::AddDelta(uint64_t delta) {
+  AddDeltaWithoutSaving(delta);
+  Save();
+}
+
+void WeeklyStorage::AddDeltaWithoutSaving(uint64_t delta) {
   base::Time now_midnight = clock_->Now().LocalMidnight();
   base::Time last_saved_midnight;
 
@@ -57,8 +76,6 @@ void WeeklyStorage::AddDelta(uint64_t delta) {
   } else {
     daily_values_.front().value += delta;
   }
-
-  Save();
 }
 
 uint64_t WeeklyStorage::GetWeeklySum() const {
@@ -80,20 +97,13 @@ uint64_t WeeklyStorage::GetHighestValueInWeek() const {
   // We record only value for last N days.
   const base::Time n_days_ago =
       clock_->Now() - base::TimeDelta::FromDays(kDaysInWeek);
-  std::list<DailyValue> last_weeks_daily_values(daily_values_.size());
-  auto copied_it =
-      std::copy_if(daily_values_.begin(), daily_values_.end(),
-                   last_weeks_daily_values.begin(),
-                   [n_days_ago](auto i) { return i.day > n_days_ago; });
-  last_weeks_daily_values.resize(
-      std::distance(last_weeks_daily_values.begin(), copied_it));
-
-  auto highest_it = std::max_element(last_weeks_daily_values.begin(),
-                                     last_weeks_daily_values.end(),
-                                     [](const auto& left, const auto& right) {
-                                       return left.value < right.value;
-                                     });
-  return highest_it->value;
+  uint64_t highest_value = 0;
+  for (const auto& daily_value : daily_values_) {
+    if (daily_value.day > n_days_ago) {
+      highest_value = std::max(highest_value, daily_value.value);
+    }
+  }
+  return highest_value;
 }
 
 bool WeeklyStorage::IsOneWeekPassed() const {
@@ -6,9 +6,9 @@
 #ifndef BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
 #define BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
 
-#include <list>
 #include <memory>
 
+#include "base/containers/circular_deque.h"
 #include "base/time/time.h"
 
 namespace base {
@@ -20,8 +20,9 @@ class PrefService;
 // Mostly used by various P3A recorders - allows to track a sum of some
 // values added from time to time via |AddDelta| over a last week.
 // Requires |pref_name| to be already registered.
-// Feel free to improve and refactor it - templatize a stored value type,
-// change weekly interval or make a keyed service from it.
+// Feel free to improve and refactor it - templatize a stored value type or
+// change weekly interval. Frequently updated values should rather go through
+// |WeeklyStorageService|, which keeps them in memory and batches the writes.
 class WeeklyStorage {
  public:
   WeeklyStorage(PrefService* prefs, const char* pref_name);
@@ -30,29 +31,38 @@ class WeeklyStorage {
   WeeklyStorage(PrefService* user_prefs,
                 const char* pref_name,
                 std::unique_ptr<base::Clock> clock);
+  // Uses |clock| without taking ownership, it must outlive this object.
+  WeeklyStorage(PrefService* user_prefs,
+                const char* pref_name,
+                base::Clock* clock);
   ~WeeklyStorage();
 
   WeeklyStorage(const WeeklyStorage&) = delete;
   WeeklyStorage& operator=(const WeeklyStorage&) = delete;
 
   void AddDelta(uint64_t delta);
+  // Same as |AddDelta|, but leaves writing the values to the caller.
+  void AddDeltaWithoutSaving(uint64_t delta);
   uint64_t GetWeeklySum() const;
   uint64_t GetHighestValueInWeek() const;
   bool IsOneWeekPassed() const;
 
+  void Save();
+
  private:
   struct DailyValue {
     base::Time day;
     uint64_t value = 0ull;
   };
   void Load();
-  void Save();
 
   PrefService* prefs_ = nullptr;
   const char* pref_name_ = nullptr;
-  std::unique_ptr<base::Clock> clock_;
+  std::unique_ptr<base::Clock> owned_clock_;
+  base::Clock* clock_ = nullptr;
 
-  std::list<DailyValue> daily_values_;
+  // Most recent day first.
+  base::circular_deque<DailyValue> daily_values_;
 };
 
 #endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
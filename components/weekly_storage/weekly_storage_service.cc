@@ -0,0 +1,73 @@
+/* Copyright 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/weekly_storage/weekly_storage_service.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/time/default_clock.h"
+#include "brave/components/weekly_storage/weekly_storage.h"
+#include "components/prefs/pref_service.h"
+
+namespace {
+constexpr base::TimeDelta kSaveDelay = base::TimeDelta::FromSeconds(10);
+}
+
+WeeklyStorageService::WeeklyStorageService(PrefService* prefs)
+    : WeeklyStorageService(prefs, std::make_unique<base::DefaultClock>()) {}
+
+WeeklyStorageService::WeeklyStorageService(PrefService* prefs,
+                                           std::unique_ptr<base::Clock> clock)
+    : prefs_(prefs), clock_(std::move(clock)) {
+  DCHECK(prefs);
+}
+
+WeeklyStorageService::~WeeklyStorageService() {
+  SaveNow();
+}
+
+uint64_t WeeklyStorageService::AddDelta(const std::string& pref_name,
+                                        uint64_t delta) {
+  WeeklyStorage* storage = GetStorage(pref_name);
+  storage->AddDeltaWithoutSaving(delta);
+
+  unsaved_storages_.insert(storage);
+  if (!save_timer_.IsRunning()) {
+    save_timer_.Start(FROM_HERE, kSaveDelay,
+                      base::BindOnce(&WeeklyStorageService::SaveNow,
+                                     base::Unretained(this)));
+  }
+
+  return storage->GetWeeklySum();
+}
+
+uint64_t WeeklyStorageService::GetWeeklySum(const std::string& pref_name) {
+  return GetStorage(pref_name)->GetWeeklySum();
+}
+
+void WeeklyStorageService::SaveNow() {
+  save_timer_.Stop();
+  for (WeeklyStorage* storage : unsaved_storages_) {
+    storage->Save();
+  }
+  unsaved_storages_.clear();
+}
+
+void WeeklyStorageService::Shutdown() {
+  SaveNow();
+}
+
+WeeklyStorage* WeeklyStorageService::GetStorage(const std::string& pref_name) {
+  auto it = storages_.find(pref_name);
+  if (it == storages_.end()) {
+    DCHECK(prefs_->FindPreference(pref_name));
+    it = storages_.emplace(pref_name, nullptr).first;
+    // The map key outlives the storage, so it can hold on to its name.
+    it->second = std::make_unique<WeeklyStorage>(prefs_, it->first.c_str(),
+                                                 clock_.get());
+  }
+  return it->second.get();
+}
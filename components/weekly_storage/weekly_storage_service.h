@@ -0,0 +1,61 @@
+/* Copyright 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_SERVICE_H_
+#define BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_SERVICE_H_
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "base/timer/timer.h"
+#include "components/keyed_service/core/keyed_service.h"
+
+namespace base {
+class Clock;
+}
+
+class PrefService;
+class WeeklyStorage;
+
+// Owns the weekly counters of a profile, so that recording an event doesn't
+// load the counter from prefs again. Counters are kept in memory and all
+// changes made within a few seconds are written to prefs at once.
+// Every |pref_name| must be a registered list pref.
+class WeeklyStorageService : public KeyedService {
+ public:
+  explicit WeeklyStorageService(PrefService* prefs);
+
+  // For tests.
+  WeeklyStorageService(PrefService* prefs, std::unique_ptr<base::Clock> clock);
+  ~WeeklyStorageService() override;
+
+  WeeklyStorageService(const WeeklyStorageService&) = delete;
+  WeeklyStorageService& operator=(const WeeklyStorageService&) = delete;
+
+  // Adds |delta| to today's value of the counter stored in |pref_name| and
+  // returns the sum over the last week.
+  uint64_t AddDelta(const std::string& pref_name, uint64_t delta);
+  uint64_t GetWeeklySum(const std::string& pref_name);
+
+  // Writes pending changes right away.
+  void SaveNow();
+
+  // KeyedService:
+  void Shutdown() override;
+
+ private:
+  WeeklyStorage* GetStorage(const std::string& pref_name);
+
+  PrefService* prefs_ = nullptr;
+  std::unique_ptr<base::Clock> clock_;
+
+  std::map<std::string, std::unique_ptr<WeeklyStorage>> storages_;
+  std::set<WeeklyStorage*> unsaved_storages_;
+  base::OneShotTimer save_timer_;
+};
+
+#endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_SERVICE_H_
@@ -0,0 +1,39 @@
+/* Copyright 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/weekly_storage/weekly_storage_service_factory.h"
+
+#include "brave/components/weekly_storage/weekly_storage_service.h"
+#include "components/keyed_service/content/browser_context_dependency_manager.h"
+#include "components/user_prefs/user_prefs.h"
+
+// static
+WeeklyStorageService* WeeklyStorageServiceFactory::GetForBrowserContext(
+    content::BrowserContext* context) {
+  return static_cast<WeeklyStorageService*>(
+      GetInstance()->GetServiceForBrowserContext(context, true));
+}
+
+// static
+WeeklyStorageServiceFactory* WeeklyStorageServiceFactory::GetInstance() {
+  return base::Singleton<WeeklyStorageServiceFactory>::get();
+}
+
+WeeklyStorageServiceFactory::WeeklyStorageServiceFactory()
+    : BrowserContextKeyedServiceFactory(
+          "WeeklyStorageService",
+          BrowserContextDependencyManager::GetInstance()) {}
+
+WeeklyStorageServiceFactory::~WeeklyStorageServiceFactory() = default;
+
+content::BrowserContext* WeeklyStorageServiceFactory::GetBrowserContextToUse(
+    content::BrowserContext* context) const {
+  return context;
+}
+
+KeyedService* WeeklyStorageServiceFactory::BuildServiceInstanceFor(
+    content::BrowserContext* context) const {
+  return new WeeklyStorageService(user_prefs::UserPrefs::Get(context));
+}
@@ -0,0 +1,41 @@
+/* Copyright 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_SERVICE_FACTORY_H_
+#define BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_SERVICE_FACTORY_H_
+
+#include "base/memory/singleton.h"
+#include "components/keyed_service/content/browser_context_keyed_service_factory.h"
+
+class WeeklyStorageService;
+
+class WeeklyStorageServiceFactory : public BrowserContextKeyedServiceFactory {
+ public:
+  static WeeklyStorageService* GetForBrowserContext(
+      content::BrowserContext* context);
+
+  static WeeklyStorageServiceFactory* GetInstance();
+
+ private:
+  friend struct base::DefaultSingletonTraits<WeeklyStorageServiceFactory>;
+
+  WeeklyStorageServiceFactory();
+  ~WeeklyStorageServiceFactory() override;
+
+  WeeklyStorageServiceFactory(const WeeklyStorageServiceFactory&) = delete;
+  WeeklyStorageServiceFactory& operator=(const WeeklyStorageServiceFactory&) =
+      delete;
+
+  // BrowserContextKeyedServiceFactory:
+
+  // Off the record contexts have their own prefs, so they get their own
+  // counters too.
+  content::BrowserContext* GetBrowserContextToUse(
+      content::BrowserContext* context) const override;
+  KeyedService* BuildServiceInstanceFor(
+      content::BrowserContext* context) const override;
+};
+
+#endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_SERVICE_FACTORY_H_
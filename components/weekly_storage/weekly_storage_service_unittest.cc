@@ -0,0 +1,83 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/weekly_storage/weekly_storage_service.h"
+
+#include <memory>
+
+#include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "brave/components/weekly_storage/weekly_storage.h"
+#include "components/prefs/pref_registry_simple.h"
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+constexpr char kFirstPrefName[] = "brave.weekly_test.first";
+constexpr char kSecondPrefName[] = "brave.weekly_test.second";
+}  // namespace
+
+class WeeklyStorageServiceTest : public ::testing::Test {
+ public:
+  WeeklyStorageServiceTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME),
+        clock_(new base::SimpleTestClock) {
+    pref_service_.registry()->RegisterListPref(kFirstPrefName);
+    pref_service_.registry()->RegisterListPref(kSecondPrefName);
+    clock_->SetNow(base::Time::Now());
+    service_ = std::make_unique<WeeklyStorageService>(
+        &pref_service_, std::unique_ptr<base::Clock>(clock_));
+  }
+
+ protected:
+  uint64_t GetSavedWeeklySum(const char* pref_name) {
+    return WeeklyStorage(&pref_service_, pref_name).GetWeeklySum();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::SimpleTestClock* clock_;
+  TestingPrefServiceSimple pref_service_;
+  std::unique_ptr<WeeklyStorageService> service_;
+};
+
+TEST_F(WeeklyStorageServiceTest, KeepsCountersApart) {
+  EXPECT_EQ(service_->AddDelta(kFirstPrefName, 10), 10ULL);
+  EXPECT_EQ(service_->AddDelta(kFirstPrefName, 5), 15ULL);
+  EXPECT_EQ(service_->AddDelta(kSecondPrefName, 1), 1ULL);
+  EXPECT_EQ(service_->GetWeeklySum(kFirstPrefName), 15ULL);
+  EXPECT_EQ(service_->GetWeeklySum(kSecondPrefName), 1ULL);
+}
+
+TEST_F(WeeklyStorageServiceTest, ForgetsOldValues) {
+  service_->AddDelta(kFirstPrefName, 10);
+  clock_->Advance(base::TimeDelta::FromDays(8));
+  EXPECT_EQ(service_->AddDelta(kFirstPrefName, 1), 1ULL);
+}
+
+TEST_F(WeeklyStorageServiceTest, SavesAfterDelay) {
+  service_->AddDelta(kFirstPrefName, 10);
+  service_->AddDelta(kSecondPrefName, 20);
+  EXPECT_EQ(GetSavedWeeklySum(kFirstPrefName), 0ULL);
+  EXPECT_EQ(GetSavedWeeklySum(kSecondPrefName), 0ULL);
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromMinutes(1));
+  EXPECT_EQ(GetSavedWeeklySum(kFirstPrefName), 10ULL);
+  EXPECT_EQ(GetSavedWeeklySum(kSecondPrefName), 20ULL);
+}
+
+TEST_F(WeeklyStorageServiceTest, SavesOnShutdown) {
+  service_->AddDelta(kFirstPrefName, 10);
+  service_->Shutdown();
+  EXPECT_EQ(GetSavedWeeklySum(kFirstPrefName), 10ULL);
+}
+
+TEST_F(WeeklyStorageServiceTest, LoadsSavedValues) {
+  service_->AddDelta(kFirstPrefName, 10);
+  service_->SaveNow();
+
+  WeeklyStorageService other_service(&pref_service_);
+  EXPECT_EQ(other_service.AddDelta(kFirstPrefName, 1), 11ULL);
+}
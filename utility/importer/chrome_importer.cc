@@ -50,6 +50,11 @@ using base::Time;
 
 namespace {
 
+// History rows and favicons are passed to the bridge in batches, so that large
+// profiles don't have to be held in memory at once.
+const size_t kHistoryRowsPerBatch = 5000;
+const size_t kFaviconsPerBatch = 100;
+
 // Most of below code is copied from os_crypt_win.cc
 #if defined(OS_WIN)
 // Contains base64 random key encrypted with DPAPI.
@@ -225,6 +230,7 @@ void ChromeImporter::ImportHistory() {
   s.BindInt64(4, ui::PAGE_TRANSITION_KEYWORD_GENERATED);
 
   std::vector<ImporterURLRow> rows;
+  rows.reserve(kHistoryRowsPerBatch);
   while (s.Step() && !cancelled()) {
     GURL url(s.ColumnString(0));
 
@@ -237,6 +243,11 @@ void ChromeImporter::ImportHistory() {
     row.visit_count = s.ColumnInt(4);
 
     rows.push_back(row);
+
+    if (rows.size() == kHistoryRowsPerBatch) {
+      bridge_->SetHistoryItems(rows, importer::VISIT_SOURCE_CHROME_IMPORTED);
+      rows.clear();
+    }
   }
 
   if (!rows.empty() && !cancelled())
@@ -271,7 +282,7 @@ void ChromeImporter::ImportBookmarks() {
       bookmark_bar->GetString("name", &name);
 
       path.push_back(name);
-      RecursiveReadBookmarksFolder(bookmark_bar, path, true, &bookmarks);
+      RecursiveReadBookmarksFolder(bookmark_bar, &path, true, &bookmarks);
     }
     // Importing other items
     if (roots->GetDictionary("other", &other)) {
@@ -280,7 +291,7 @@ void ChromeImporter::ImportBookmarks() {
       other->GetString("name", &name);
 
       path.push_back(name);
-      RecursiveReadBookmarksFolder(other, path, false, &bookmarks);
+      RecursiveReadBookmarksFolder(other, &path, false, &bookmarks);
     }
   }
   // Write into profile.
@@ -308,11 +319,8 @@ void ChromeImporter::ImportBookmarks() {
   FaviconMap favicon_map;
   ImportFaviconURLs(&db, &favicon_map);
   // Write favicons into profile.
-  if (!favicon_map.empty() && !cancelled()) {
-    favicon_base::FaviconUsageDataList favicons;
-    LoadFaviconData(&db, favicon_map, &favicons);
-    bridge_->SetFavicons(favicons);
-  }
+  if (!favicon_map.empty() && !cancelled())
+    ImportFaviconData(&db, &favicon_map);
 }
 
 void ChromeImporter::ImportFaviconURLs(
@@ -328,48 +336,60 @@ void ChromeImporter::ImportFaviconURLs(
   }
 }
 
-void ChromeImporter::LoadFaviconData(
+void ChromeImporter::ImportFaviconData(
     sql::Database* db,
-    const FaviconMap& favicon_map,
-    favicon_base::FaviconUsageDataList* favicons) {
-  const char query[] = "SELECT f.url, fb.image_data "
+    FaviconMap* favicon_map) {
+  // Favicons can have several bitmaps, of which only the first is imported.
+  const char query[] = "SELECT f.id, f.url, fb.image_data "
                        "FROM favicons f "
                        "JOIN favicon_bitmaps fb "
                        "ON f.id = fb.icon_id "
-                       "WHERE f.id = ?;";
+                       "ORDER BY f.id, fb.id;";
   sql::Statement s(db->GetUniqueStatement(query));
 
   if (!s.is_valid())
     return;
 
-  for (FaviconMap::const_iterator i = favicon_map.begin();
-       i != favicon_map.end(); ++i) {
-    s.BindInt64(0, i->first);
-    if (s.Step()) {
-      favicon_base::FaviconUsageData usage;
+  favicon_base::FaviconUsageDataList favicons;
+  while (s.Step() && !cancelled()) {
+    FaviconMap::iterator i = favicon_map->find(s.ColumnInt64(0));
+    if (i == favicon_map->end() || i->second.empty())
+      continue;  // Not used by any page, or already imported.
 
-      usage.favicon_url = GURL(s.ColumnString(0));
-      if (!usage.favicon_url.is_valid())
-        continue;  // Don't bother importing favicons with invalid URLs.
+    favicon_base::FaviconUsageData usage;
 
-      std::vector<unsigned char> data;
-      s.ColumnBlobAsVector(1, &data);
-      if (data.empty())
-        continue;  // Data definitely invalid.
+    usage.favicon_url = GURL(s.ColumnString(1));
+    if (!usage.favicon_url.is_valid())
+      continue;  // Don't bother importing favicons with invalid URLs.
 
-      if (!importer::ReencodeFavicon(&data[0], data.size(), &usage.png_data))
-        continue;  // Unable to decode.
+    const int data_length = s.ColumnByteLength(2);
+    if (data_length <= 0)
+      continue;  // Data definitely invalid.
 
-      usage.urls = i->second;
-      favicons->push_back(usage);
+    // Reencode straight from the row instead of copying the blob.
+    if (!importer::ReencodeFavicon(
+            static_cast<const unsigned char*>(s.ColumnBlob(2)), data_length,
+            &usage.png_data)) {
+      continue;  // Unable to decode.
+    }
+
+    usage.urls = std::move(i->second);
+    i->second.clear();
+    favicons.push_back(std::move(usage));
+
+    if (favicons.size() == kFaviconsPerBatch) {
+      bridge_->SetFavicons(favicons);
+      favicons.clear();
     }
-    s.Reset(true);
   }
+
+  if (!favicons.empty() && !cancelled())
+    bridge_->SetFavicons(favicons);
 }
 
 void ChromeImporter::RecursiveReadBookmarksFolder(
   const base::DictionaryValue* folder,
-  const std::vector<base::string16>& parent_path,
+  std::vector<base::string16>* path,
   bool is_in_toolbar,
   std::vector<ImportedBookmarkEntry>* bookmarks) {
   const base::ListValue* children;
@@ -393,21 +413,21 @@ void ChromeImporter::RecursiveReadBookmarksFolder(
           entry.in_toolbar = is_in_toolbar;
           entry.is_folder = true;
           entry.url = GURL();
-          entry.path = parent_path;
+          entry.path = *path;
           entry.title = name;
           entry.creation_time =
             base::Time::FromDoubleT(chromeTimeToDouble(std::stoll(date_added)));
           bookmarks->push_back(entry);
         }
 
-        std::vector<base::string16> path = parent_path;
-        path.push_back(name);
+        path->push_back(name);
         RecursiveReadBookmarksFolder(dict, path, is_in_toolbar, bookmarks);
+        path->pop_back();
       } else if (type == "url") {
         entry.in_toolbar = is_in_toolbar;
         entry.is_folder = false;
         entry.url = GURL(url);
-        entry.path = parent_path;
+        entry.path = *path;
         entry.title = name;
         entry.creation_time =
           base::Time::FromDoubleT(chromeTimeToDouble(std::stoll(date_added)));
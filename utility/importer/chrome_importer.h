@@ -62,14 +62,15 @@ class ChromeImporter : public Importer {
     sql::Database* db,
     FaviconMap* favicon_map);
 
-  // Loads and reencodes the individual favicons.
-  void LoadFaviconData(sql::Database* db,
-                       const FaviconMap& favicon_map,
-                       favicon_base::FaviconUsageDataList* favicons);
+  // Loads and reencodes the individual favicons with a single query, passing
+  // them to the bridge in batches. The urls are moved out of favicon_map.
+  void ImportFaviconData(sql::Database* db, FaviconMap* favicon_map);
 
+  // |path| is shared by all folders, with each folder appending its name
+  // before reading its children and removing it afterwards.
   void RecursiveReadBookmarksFolder(
     const base::DictionaryValue* folder,
-    const std::vector<base::string16>& parent_path,
+    std::vector<base::string16>* path,
     bool is_in_toolbar,
     std::vector<ImportedBookmarkEntry>* bookmarks);
 